@@ -0,0 +1,161 @@
+#if defined(WIND_BENCHMARK_COUNT_ALLOCATIONS)
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "allocation_counter.hpp"
+
+// Every block starts with a header holding its size, so unsized deletes know how much they free. Over-aligned blocks
+// get a header of their alignment, which keeps the memory after it aligned.
+namespace
+{
+constexpr size_t header_size = alignof(std::max_align_t);
+
+auto counted_allocate(size_t size, size_t alignment = header_size) noexcept -> void*
+{
+    auto header = alignment > header_size ? alignment : header_size;
+    std::byte* block = nullptr;
+    if (alignment > header_size) {
+        // aligned_alloc wants a multiple of the alignment
+        auto rounded = (size + header + alignment - 1) / alignment * alignment;
+        block = static_cast<std::byte*>(std::aligned_alloc(alignment, rounded));  // NOLINT(cppcoreguidelines-no-malloc)
+    } else {
+        block = static_cast<std::byte*>(std::malloc(size + header));  // NOLINT(cppcoreguidelines-no-malloc)
+    }
+    if (block == nullptr) {
+        return nullptr;
+    }
+    new (block) size_t {size};
+    allocation_counter::on_allocate(size);
+    return block + header;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+auto counted_allocate_or_throw(size_t size, size_t alignment = header_size) -> void*
+{
+    size = size == 0 ? 1 : size;
+    while (true) {
+        if (auto* ptr = counted_allocate(size, alignment)) {
+            return ptr;
+        }
+        auto* handler = std::get_new_handler();
+        if (handler == nullptr) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void counted_deallocate(void* ptr, size_t alignment = header_size) noexcept
+{
+    if (ptr == nullptr) {
+        return;
+    }
+    auto header = alignment > header_size ? alignment : header_size;
+    auto* block = static_cast<std::byte*>(ptr) - header;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    allocation_counter::on_deallocate(*std::launder(reinterpret_cast<size_t*>(block)));  // NOLINT
+    std::free(block);  // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+}  // namespace
+
+auto operator new(size_t size) -> void*
+{
+    return counted_allocate_or_throw(size);
+}
+
+auto operator new[](size_t size) -> void*
+{
+    return counted_allocate_or_throw(size);
+}
+
+auto operator new(size_t size, const std::nothrow_t& /*tag*/) noexcept -> void*
+{
+    return counted_allocate(size == 0 ? 1 : size);
+}
+
+auto operator new[](size_t size, const std::nothrow_t& /*tag*/) noexcept -> void*
+{
+    return counted_allocate(size == 0 ? 1 : size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    counted_deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    counted_deallocate(ptr);
+}
+
+void operator delete(void* ptr, size_t /*size*/) noexcept
+{
+    counted_deallocate(ptr);
+}
+
+void operator delete[](void* ptr, size_t /*size*/) noexcept
+{
+    counted_deallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t& /*tag*/) noexcept
+{
+    counted_deallocate(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t& /*tag*/) noexcept
+{
+    counted_deallocate(ptr);
+}
+
+auto operator new(size_t size, std::align_val_t alignment) -> void*
+{
+    return counted_allocate_or_throw(size, static_cast<size_t>(alignment));
+}
+
+auto operator new[](size_t size, std::align_val_t alignment) -> void*
+{
+    return counted_allocate_or_throw(size, static_cast<size_t>(alignment));
+}
+
+auto operator new(size_t size, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept -> void*
+{
+    return counted_allocate(size == 0 ? 1 : size, static_cast<size_t>(alignment));
+}
+
+auto operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept -> void*
+{
+    return counted_allocate(size == 0 ? 1 : size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr, std::align_val_t alignment) noexcept
+{
+    counted_deallocate(ptr, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept
+{
+    counted_deallocate(ptr, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr, size_t /*size*/, std::align_val_t alignment) noexcept
+{
+    counted_deallocate(ptr, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* ptr, size_t /*size*/, std::align_val_t alignment) noexcept
+{
+    counted_deallocate(ptr, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept
+{
+    counted_deallocate(ptr, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* ptr, std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept
+{
+    counted_deallocate(ptr, static_cast<size_t>(alignment));
+}
+
+#endif
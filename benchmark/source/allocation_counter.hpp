@@ -0,0 +1,106 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+#include <shared_ptr/bias_shared_ptr.hpp>
+
+// Counts the heap allocations made through the global operator new. allocation_counter.cpp replaces operator new and
+// delete with counting versions when the benchmark is built with WIND_BENCHMARK_COUNT_ALLOCATIONS, which the
+// shared_ptr_BENCHMARK_COUNT_ALLOCATIONS CMake option sets. Otherwise nothing is counted and no counters are reported.
+// Counting adds two atomic updates to every allocation, so timings of such a build are not comparable to a normal one.
+namespace allocation_counter
+{
+#if defined(WIND_BENCHMARK_COUNT_ALLOCATIONS)
+inline constexpr bool enabled = true;
+#else
+inline constexpr bool enabled = false;
+#endif
+
+// process-wide, as the blocks of one thread are often freed by another
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+inline std::atomic<int64_t> allocations {0};
+inline std::atomic<int64_t> live_bytes {0};
+inline std::atomic<int64_t> live_allocations {0};
+inline std::atomic<int64_t> peak_live_bytes {0};
+inline std::atomic<int64_t> live_allocations_at_peak {0};
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+inline void on_allocate(size_t size) noexcept
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    auto count = live_allocations.fetch_add(1, std::memory_order_relaxed) + 1;
+    auto signed_size = static_cast<int64_t>(size);
+    auto bytes = live_bytes.fetch_add(signed_size, std::memory_order_relaxed) + signed_size;
+
+    auto peak = peak_live_bytes.load(std::memory_order_relaxed);
+    while (bytes > peak) {
+        if (peak_live_bytes.compare_exchange_weak(peak, bytes, std::memory_order_relaxed)) {
+            live_allocations_at_peak.store(count, std::memory_order_relaxed);
+            break;
+        }
+    }
+}
+
+inline void on_deallocate(size_t size) noexcept
+{
+    live_allocations.fetch_sub(1, std::memory_order_relaxed);
+    live_bytes.fetch_sub(static_cast<int64_t>(size), std::memory_order_relaxed);
+}
+
+// Reports what was allocated from its construction until the end of the benchmark as counters:
+//
+//  - allocations_per_op: allocations per iteration of the benchmark loop, per thread
+//  - bytes_per_live_object: heap bytes per live allocation at the peak of the run, not counting what was live before it
+//  - tls_bytes: heap bytes the thread_local_storage behind bias::shared_ptr holds on the reporting thread
+//
+// Only the first thread of a run measures and reports, as the counts are process-wide.
+class report
+{
+  public:
+    explicit report(benchmark::State& state) noexcept
+        : state_(state)
+        , measuring_(enabled && state.thread_index() == 0)
+    {
+        if (!this->measuring_) {
+            return;
+        }
+        this->allocations_before_ = allocations.load(std::memory_order_relaxed);
+        this->bytes_before_ = live_bytes.load(std::memory_order_relaxed);
+        this->objects_before_ = live_allocations.load(std::memory_order_relaxed);
+        peak_live_bytes.store(this->bytes_before_, std::memory_order_relaxed);
+        live_allocations_at_peak.store(this->objects_before_, std::memory_order_relaxed);
+    }
+
+    report(const report&) = delete;
+    report(report&&) = delete;
+    auto operator=(const report&) -> report& = delete;
+    auto operator=(report&&) -> report& = delete;
+
+    ~report()
+    {
+        if (!this->measuring_) {
+            return;
+        }
+        auto allocated = allocations.load(std::memory_order_relaxed) - this->allocations_before_;
+        auto peak_bytes = peak_live_bytes.load(std::memory_order_relaxed) - this->bytes_before_;
+        auto peak_objects = live_allocations_at_peak.load(std::memory_order_relaxed) - this->objects_before_;
+
+        this->state_.counters["allocations_per_op"] =
+            benchmark::Counter(static_cast<double>(allocated), benchmark::Counter::kAvgIterations);
+        this->state_.counters["bytes_per_live_object"] =
+            peak_objects > 0 ? static_cast<double>(peak_bytes) / static_cast<double>(peak_objects) : 0.0;
+        this->state_.counters["tls_bytes"] =
+            static_cast<double>(wind::bias::detail::local_count_storage::memory_usage());
+    }
+
+  private:
+    benchmark::State& state_;
+    bool measuring_;
+    int64_t allocations_before_ {0};
+    int64_t bytes_before_ {0};
+    int64_t objects_before_ {0};
+};
+
+}  // namespace allocation_counter
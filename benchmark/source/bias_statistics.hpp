@@ -0,0 +1,54 @@
+#pragma once
+#include <benchmark/benchmark.h>
+#include <shared_ptr/bias_shared_ptr.hpp>
+
+namespace bias_statistics
+{
+// Reports the hot path events of bias::shared_ptr from its construction until the end of the benchmark, per
+// iteration of the benchmark loop and thread, when the library keeps statistics. Only the first thread of a run
+// reports, as the statistics are summed over all threads.
+class report
+{
+  public:
+    explicit report(benchmark::State& state)
+        : state_(state)
+        , measuring_(wind::bias::detail::keep_statistics && state.thread_index() == 0)
+    {
+        if (this->measuring_) {
+            this->before_ = wind::bias::read_statistics();
+        }
+    }
+
+    report(const report&) = delete;
+    report(report&&) = delete;
+    auto operator=(const report&) -> report& = delete;
+    auto operator=(report&&) -> report& = delete;
+
+    ~report()
+    {
+        if (!this->measuring_) {
+            return;
+        }
+        auto counted = wind::bias::read_statistics() - this->before_;
+        this->add("local_hits", counted.local_hits);
+        this->add("local_misses", counted.local_misses);
+        this->add("global_increments", counted.global_increments);
+        this->add("global_decrements", counted.global_decrements);
+        this->add("keys_created", counted.keys_created);
+        this->add("keys_returned", counted.keys_returned);
+        this->add("control_blocks_destroyed", counted.control_blocks_destroyed);
+    }
+
+  private:
+    void add(const char* name, size_t count)
+    {
+        this->state_.counters[name] =
+            benchmark::Counter(static_cast<double>(count), benchmark::Counter::kAvgIterations);
+    }
+
+    benchmark::State& state_;
+    bool measuring_;
+    wind::bias::statistics before_ {};
+};
+
+}  // namespace bias_statistics
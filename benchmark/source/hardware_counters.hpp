@@ -0,0 +1,128 @@
+#pragma once
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+#include <benchmark/benchmark.h>
+
+#if defined(WIND_BENCHMARK_HARDWARE_COUNTERS) && defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Counts hardware events with perf_event_open when the benchmark is built with WIND_BENCHMARK_HARDWARE_COUNTERS, which
+// the shared_ptr_BENCHMARK_HARDWARE_COUNTERS CMake option sets. Events the kernel or the machine do not permit, e.g.
+// under a perf_event_paranoid above 2 or in a virtual machine without a PMU, are left out, and a note says so once.
+// Other platforms and normal builds report nothing.
+namespace hardware_counters
+{
+#if defined(WIND_BENCHMARK_HARDWARE_COUNTERS) && defined(__linux__)
+struct event
+{
+    const char* name;
+    uint32_t type;
+    uint64_t config;
+};
+
+inline constexpr auto l1d_read_miss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8U)
+    | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16U);
+
+inline constexpr auto events = std::array {
+    event {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    event {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    event {"l1d_misses", PERF_TYPE_HW_CACHE, l1d_read_miss},
+    event {"llc_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    event {"branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+};
+
+// counts the event on the calling thread in user space, returns -1 if that is not permitted
+inline auto open_counter(const event& counted) noexcept -> int
+{
+    auto attributes = perf_event_attr {};
+    attributes.size = sizeof(attributes);
+    attributes.type = counted.type;
+    attributes.config = counted.config;
+    attributes.disabled = 1;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    auto fd = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));  // NOLINT
+    if (fd < 0) {
+        // noted for the first missing counter only, which is usually missing for the same reason as the others
+        static const auto noted =
+            (std::cerr << "hardware counter " << counted.name << " is not available: " << std::strerror(errno) << "\n",
+             true);
+        static_cast<void>(noted);
+    }
+    return fd;
+}
+
+// the count so far, scaled up for the time the kernel had to multiplex the counter away
+inline auto read_counter(int fd) noexcept -> double
+{
+    auto values = std::array<uint64_t, 3> {};  // value, time enabled, time running
+    if (read(fd, values.data(), sizeof(values)) != sizeof(values) || values[2] == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(values[0]) * static_cast<double>(values[1]) / static_cast<double>(values[2]);
+}
+#endif
+
+// Reports the hardware events of the calling thread from its construction until the end of the benchmark, per
+// iteration of the benchmark loop. Every thread of a run counts itself, and the counts are averaged over them.
+class report
+{
+  public:
+    explicit report(benchmark::State& state) noexcept
+        : state_(state)
+    {
+#if defined(WIND_BENCHMARK_HARDWARE_COUNTERS) && defined(__linux__)
+        for (size_t i = 0; i < events.size(); i++) {
+            this->fds_[i] = open_counter(events[i]);
+        }
+        for (auto fd : this->fds_) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+            }
+        }
+#endif
+    }
+
+    report(const report&) = delete;
+    report(report&&) = delete;
+    auto operator=(const report&) -> report& = delete;
+    auto operator=(report&&) -> report& = delete;
+
+    ~report()
+    {
+#if defined(WIND_BENCHMARK_HARDWARE_COUNTERS) && defined(__linux__)
+        for (auto fd : this->fds_) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+            }
+        }
+        for (size_t i = 0; i < events.size(); i++) {
+            if (this->fds_[i] < 0) {
+                continue;
+            }
+            this->state_.counters[events[i].name] =
+                benchmark::Counter(read_counter(this->fds_[i]), benchmark::Counter::kAvgIterations);
+            close(this->fds_[i]);
+        }
+#endif
+    }
+
+  private:
+    [[maybe_unused]] benchmark::State& state_;
+#if defined(WIND_BENCHMARK_HARDWARE_COUNTERS) && defined(__linux__)
+    std::array<int, events.size()> fds_ {};
+#endif
+};
+
+}  // namespace hardware_counters
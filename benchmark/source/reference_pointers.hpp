@@ -0,0 +1,233 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+#include <shared_ptr/basic_shared_ptr.hpp>
+
+// Textbook reference counting schemes the benchmarks compare the library's policies against, built on
+// basic_shared_ptr so they differ from the other pointers only in how they count:
+//
+//  - reference::naive: one atomic counter, every update a sequentially consistent read-modify-write
+//  - reference::locked: a plain counter guarded by a mutex in the control block
+//
+// Relaxed increments with acquire-release decrements, as std::shared_ptr does them, are wind::atomic, and an
+// intrusive atomic counter is wind::intrusive_ptr over wind::atomic_counted, so neither is repeated here.
+namespace reference
+{
+namespace naive
+{
+namespace detail
+{
+struct control_block : wind::detail::managed_control_block<control_block>
+{
+    std::atomic<size_t> counter {1};
+    // number of weak_ptrs, plus one while counter is non-zero
+    std::atomic<size_t> weak_counter {1};
+
+    control_block() noexcept = default;
+    control_block(const control_block&) = delete;
+    control_block(control_block&&) = delete;
+    auto operator=(const control_block&) -> control_block& = delete;
+    auto operator=(control_block&&) -> control_block& = delete;
+
+    void inc_weak() noexcept
+    {
+        this->weak_counter++;
+    }
+
+    [[nodiscard]] auto decrement_weak_and_check_zero() noexcept -> bool
+    {
+        return --this->weak_counter == 0;
+    }
+
+    void release_data() noexcept
+    {
+        this->destroy_data();
+        if (this->decrement_weak_and_check_zero()) {
+            this->deallocate();
+        }
+    }
+};
+
+}  // namespace detail
+
+struct counting_policy
+{
+    using control_block = detail::control_block;
+
+    struct handle
+    {
+    };
+
+    [[nodiscard]] static auto handle_of(control_block* /*control*/) noexcept -> handle
+    {
+        return {};
+    }
+
+    static void add_reference(control_block* control, handle /*handle*/) noexcept
+    {
+        control->counter++;
+    }
+
+    static void release_reference(control_block* control, handle /*handle*/) noexcept
+    {
+        if (--control->counter == 0) {
+            control->release_data();
+        }
+    }
+
+    [[nodiscard]] static auto try_add_reference(control_block* control) noexcept -> bool
+    {
+        auto count = control->counter.load();
+        while (count != 0) {
+            if (control->counter.compare_exchange_weak(count, count + 1)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    [[nodiscard]] static auto use_count(const control_block* control) noexcept -> size_t
+    {
+        return control->counter.load();
+    }
+
+    [[nodiscard]] static auto expired(const control_block* control) noexcept -> bool
+    {
+        return control->counter.load() == 0;
+    }
+
+    [[nodiscard]] static auto unique(const control_block* control, handle /*handle*/) noexcept -> bool
+    {
+        return control->counter.load() == 1;
+    }
+};
+
+template<typename T>
+using shared_ptr = wind::basic_shared_ptr<T, counting_policy>;
+
+template<typename T>
+using weak_ptr = wind::basic_weak_ptr<T, counting_policy>;
+
+template<typename T>
+inline constexpr wind::detail::make_shared_function<T, counting_policy> make_shared {};
+
+template<typename T>
+inline constexpr wind::detail::allocate_shared_function<T, counting_policy> allocate_shared {};
+
+}  // namespace naive
+
+namespace locked
+{
+namespace detail
+{
+struct control_block : wind::detail::managed_control_block<control_block>
+{
+    mutable std::mutex mutex;
+    size_t counter {1};
+    // number of weak_ptrs, plus one while counter is non-zero
+    size_t weak_counter {1};
+
+    control_block() noexcept = default;
+    control_block(const control_block&) = delete;
+    control_block(control_block&&) = delete;
+    auto operator=(const control_block&) -> control_block& = delete;
+    auto operator=(control_block&&) -> control_block& = delete;
+
+    void inc_weak() noexcept
+    {
+        auto lock = std::lock_guard(this->mutex);
+        this->weak_counter++;
+    }
+
+    [[nodiscard]] auto decrement_weak_and_check_zero() noexcept -> bool
+    {
+        auto lock = std::lock_guard(this->mutex);
+        return --this->weak_counter == 0;
+    }
+
+    void release_data() noexcept
+    {
+        this->destroy_data();
+        if (this->decrement_weak_and_check_zero()) {
+            this->deallocate();
+        }
+    }
+};
+
+}  // namespace detail
+
+struct counting_policy
+{
+    using control_block = detail::control_block;
+
+    struct handle
+    {
+    };
+
+    [[nodiscard]] static auto handle_of(control_block* /*control*/) noexcept -> handle
+    {
+        return {};
+    }
+
+    static void add_reference(control_block* control, handle /*handle*/) noexcept
+    {
+        auto lock = std::lock_guard(control->mutex);
+        control->counter++;
+    }
+
+    static void release_reference(control_block* control, handle /*handle*/) noexcept
+    {
+        auto last = false;
+        {
+            auto lock = std::lock_guard(control->mutex);
+            last = --control->counter == 0;
+        }
+        if (last) {
+            control->release_data();
+        }
+    }
+
+    [[nodiscard]] static auto try_add_reference(control_block* control) noexcept -> bool
+    {
+        auto lock = std::lock_guard(control->mutex);
+        if (control->counter == 0) {
+            return false;
+        }
+        control->counter++;
+        return true;
+    }
+
+    [[nodiscard]] static auto use_count(const control_block* control) noexcept -> size_t
+    {
+        auto lock = std::lock_guard(control->mutex);
+        return control->counter;
+    }
+
+    [[nodiscard]] static auto expired(const control_block* control) noexcept -> bool
+    {
+        return use_count(control) == 0;
+    }
+
+    [[nodiscard]] static auto unique(const control_block* control, handle /*handle*/) noexcept -> bool
+    {
+        return use_count(control) == 1;
+    }
+};
+
+template<typename T>
+using shared_ptr = wind::basic_shared_ptr<T, counting_policy>;
+
+template<typename T>
+using weak_ptr = wind::basic_weak_ptr<T, counting_policy>;
+
+template<typename T>
+inline constexpr wind::detail::make_shared_function<T, counting_policy> make_shared {};
+
+template<typename T>
+inline constexpr wind::detail::allocate_shared_function<T, counting_policy> allocate_shared {};
+
+}  // namespace locked
+
+}  // namespace reference
@@ -1,15 +1,70 @@
 #include <array>
 #include <iostream>
+#include <iterator>
 #include <memory>
-#include <thread>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
 #include <vector>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include <benchmark/benchmark.h>
+#include <shared_ptr/atomic_counting_shared_ptr.hpp>
+#include <shared_ptr/bias_atomic_shared_ptr.hpp>
 #include <shared_ptr/bias_shared_ptr.hpp>
+#include <shared_ptr/compact_shared_ptr.hpp>
+#include <shared_ptr/epoch.hpp>
+#include <shared_ptr/intrusive_ptr.hpp>
 #include <shared_ptr/local_shared_ptr.hpp>
+#include <shared_ptr/owner_bias_shared_ptr.hpp>
+#include <shared_ptr/rcu_cell.hpp>
+#include <shared_ptr/slab_allocator.hpp>
+#include <shared_ptr/thread_local_storage.hpp>
+
+#include "allocation_counter.hpp"
+#include "bias_statistics.hpp"
+#include "hardware_counters.hpp"
+#include "reference_pointers.hpp"
 
 // benchmark functions
 
+// bytes handed out by counting_allocator, which is stateless so it takes no space in the control blocks
+inline size_t counting_allocator_bytes = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+template<typename T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    counting_allocator() noexcept = default;
+
+    template<typename U>
+    counting_allocator(const counting_allocator<U>& /*other*/) noexcept  // NOLINT(google-explicit-constructor)
+    {
+    }
+
+    auto allocate(size_t size) -> T*
+    {
+        counting_allocator_bytes += size * sizeof(T);
+        return std::allocator<T>().allocate(size);
+    }
+
+    void deallocate(T* ptr, size_t size) noexcept
+    {
+        std::allocator<T>().deallocate(ptr, size);
+    }
+
+    template<typename U>
+    auto operator==(const counting_allocator<U>& /*other*/) const noexcept -> bool
+    {
+        return true;
+    }
+};
+
 template<typename FuncT>
 void copying(int64_t num_copies, const FuncT& generator)
 {
@@ -20,6 +75,29 @@ void copying(int64_t num_copies, const FuncT& generator)
     }
 }
 
+template<typename FuncT>
+void dereferencing(int64_t num_dereferences, const FuncT& generator)
+{
+    auto ptr = generator();
+    int64_t sum = 0;
+    for (auto j = 0; j < num_dereferences; j++) {
+        benchmark::DoNotOptimize(ptr);
+        sum += *ptr;
+    }
+    benchmark::DoNotOptimize(sum);
+}
+
+template<typename WeakT, typename FuncT>
+void locking(int64_t num_locks, const FuncT& generator)
+{
+    auto ptr = generator();
+    auto weak = WeakT(ptr);
+    for (auto j = 0; j < num_locks; j++) {
+        auto locked = weak.lock();
+        benchmark::DoNotOptimize(locked);
+    }
+}
+
 template<typename FuncT>
 void copy_and_release(int64_t num_iteration, int64_t num_copies, const FuncT& generator)
 {
@@ -32,6 +110,33 @@ void copy_and_release(int64_t num_iteration, int64_t num_copies, const FuncT& ge
     }
 }
 
+// every object is released right after it was created, so this measures allocating and freeing control blocks
+template<typename FuncT>
+void make_and_release(int64_t num_objects, const FuncT& generator)
+{
+    for (int64_t i = 0; i < num_objects; i++) {
+        auto ptr = generator(i);
+        benchmark::DoNotOptimize(ptr);
+    }
+}
+
+// keeps num_objects alive at once and returns what each costs: its pointer plus the bytes allocated for it
+template<typename FuncT>
+auto bytes_per_object(int64_t num_objects, const FuncT& generator) -> double
+{
+    using shared_ptr_type = typename std::invoke_result_t<FuncT, int>;
+
+    auto ptrs = std::vector<shared_ptr_type>();
+    ptrs.reserve(static_cast<size_t>(num_objects));
+    auto allocated_before = counting_allocator_bytes;
+    for (int64_t i = 0; i < num_objects; i++) {
+        ptrs.push_back(generator(i));
+    }
+    benchmark::DoNotOptimize(ptrs);
+    auto allocated = counting_allocator_bytes - allocated_before;
+    return static_cast<double>(allocated + ptrs.size() * sizeof(shared_ptr_type)) / static_cast<double>(num_objects);
+}
+
 template<typename FuncT>
 void copy_and_release_many(int64_t num_iteration, int64_t num_copies, const FuncT& generator)
 {
@@ -63,54 +168,367 @@ void push_continuously_to_vector(int64_t num_iteration, const FuncT& generator)
     benchmark::DoNotOptimize(ptrs);
 }
 
+// num_ptrs copies of num_objects objects, taking turns
 template<typename FuncT>
-void copy_back_and_forth_between_threads(int64_t num_iteration,
-                                         int64_t num_copies,
-                                         int64_t num_threads,
-                                         const FuncT& generator)
+auto ptrs_over_objects(int64_t num_ptrs, int64_t num_objects, const FuncT& generator)
 {
     using shared_ptr_type = typename std::invoke_result_t<FuncT, int>;
 
+    auto objects = std::vector<shared_ptr_type>();
+    for (int64_t i = 0; i < num_objects; i++) {
+        objects.push_back(generator(i));
+    }
     auto ptrs = std::vector<shared_ptr_type>();
-    for (auto i = 0; i < num_copies; i++) {
-        ptrs.push_back(generator(i));
+    for (int64_t i = 0; i < num_ptrs; i++) {
+        ptrs.push_back(objects[static_cast<size_t>(i % num_objects)]);
+    }
+    return ptrs;
+}
+
+// Pins the calling thread to one of the CPUs the process may run on, picked by its index in the benchmark's thread
+// group, and restores its previous affinity when it goes out of scope. Only on Linux, elsewhere it does nothing.
+struct cpu_pin
+{
+#if defined(__linux__)
+    cpu_set_t previous {};
+    bool pinned {false};
+#endif
+
+    explicit cpu_pin(int thread_index)
+    {
+#if defined(__linux__)
+        if (pthread_getaffinity_np(pthread_self(), sizeof(this->previous), &this->previous) != 0) {
+            return;
+        }
+        auto target = thread_index % CPU_COUNT(&this->previous);
+        auto cpu = 0;
+        while (!CPU_ISSET(cpu, &this->previous) || target-- != 0) {  // NOLINT
+            cpu++;
+        }
+        auto single = cpu_set_t {};
+        CPU_ZERO(&single);  // NOLINT
+        CPU_SET(cpu, &single);  // NOLINT
+        this->pinned = pthread_setaffinity_np(pthread_self(), sizeof(single), &single) == 0;
+#else
+        static_cast<void>(thread_index);
+#endif
+    }
+
+    cpu_pin(const cpu_pin&) = delete;
+    cpu_pin(cpu_pin&&) = delete;
+    auto operator=(const cpu_pin&) -> cpu_pin& = delete;
+    auto operator=(cpu_pin&&) -> cpu_pin& = delete;
+
+    ~cpu_pin()
+    {
+#if defined(__linux__)
+        if (this->pinned) {
+            pthread_setaffinity_np(pthread_self(), sizeof(this->previous), &this->previous);
+        }
+#endif
+    }
+};
+
+// The multi-threaded benchmarks run on google benchmark's thread groups: the threads live for a whole run, are pinned
+// to their own CPUs and start and stop their timed loops together. Objects shared by the group are created by thread
+// 0 before its loop and released after it, which the other threads only touch inside theirs.
+
+// Every thread keeps copying state.range(0) pointers shared by all threads back and forth between two vectors of
+// its own. With own_objects, every thread copies objects it made itself instead, for pointers that are not thread
+// safe.
+template<typename FuncT>
+void copy_back_and_forth_between_threads(benchmark::State& state, const FuncT& generator, bool own_objects = false)
+{
+    using shared_ptr_type = typename std::invoke_result_t<FuncT, int>;
+
+    static auto shared = std::vector<shared_ptr_type>();
+    auto pin = cpu_pin(state.thread_index());
+    auto num_copies = static_cast<uint64_t>(state.range(0));
+
+    auto own = std::vector<shared_ptr_type>();
+    auto& ptrs = own_objects ? own : shared;
+    if (own_objects || state.thread_index() == 0) {
+        for (uint64_t i = 0; i < num_copies; i++) {
+            ptrs.push_back(generator(static_cast<int>(i)));
+        }
+    }
+    auto local_ptrs = std::vector<shared_ptr_type>(num_copies);
+    auto local_ptrs2 = std::vector<shared_ptr_type>(num_copies);
+
+    uint64_t i = 0;
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        local_ptrs.at(i % num_copies) = ptrs.at(i % num_copies);
+        for (uint64_t j = 0; j < num_copies; j++) {
+            local_ptrs2.at((i * j) % num_copies) = local_ptrs.at((i + j) % num_copies);
+        }
+        i++;
+    }
+    benchmark::DoNotOptimize(local_ptrs);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+    if (state.thread_index() == 0) {
+        shared.clear();
+    }
+}
+
+// every thread repeatedly takes a single copy of the same pointer and releases it again
+template<typename FuncT>
+void copy_and_release_on_threads(benchmark::State& state, const FuncT& generator)
+{
+    using shared_ptr_type = typename std::invoke_result_t<FuncT, int>;
+
+    static auto ptr = shared_ptr_type();
+    auto pin = cpu_pin(state.thread_index());
+    if (state.thread_index() == 0) {
+        ptr = generator(0);
+    }
+
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        auto copy = ptr;
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0) {
+        ptr = shared_ptr_type();
+    }
+}
+
+// every thread creates and releases num_allocations pointers of its own
+template<typename FuncT>
+void allocate_on_threads(benchmark::State& state, int64_t num_allocations, const FuncT& generator)
+{
+    using shared_ptr_type = typename std::invoke_result_t<FuncT, int>;
+
+    auto pin = cpu_pin(state.thread_index());
+    auto ptrs = std::vector<shared_ptr_type>();
+    ptrs.reserve(static_cast<size_t>(num_allocations));
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        for (auto i = 0; i < num_allocations; i++) {
+            ptrs.push_back(generator(i));
+        }
+        benchmark::DoNotOptimize(ptrs);
+        ptrs.clear();
     }
+    state.SetItemsProcessed(state.iterations() * num_allocations);
+}
+
+// Every thread creates num_allocations pointers per iteration and hands them to its neighbour, which releases them in
+// its next iteration.
+template<typename FuncT>
+void release_on_other_threads(benchmark::State& state, int64_t num_allocations, const FuncT& generator)
+{
+    using shared_ptr_type = typename std::invoke_result_t<FuncT, int>;
+
+    struct outbox
+    {
+        std::mutex mutex;
+        std::vector<shared_ptr_type> ptrs;
+    };
+
+    static auto outboxes = std::vector<outbox>();
+    auto pin = cpu_pin(state.thread_index());
+    if (state.thread_index() == 0) {
+        outboxes = std::vector<outbox>(static_cast<size_t>(state.threads()));
+    }
+    auto mine = static_cast<size_t>(state.thread_index());
+    auto neighbours = static_cast<size_t>((state.thread_index() + 1) % state.threads());
+
+    auto made = std::vector<shared_ptr_type>();
+    auto taken = std::vector<shared_ptr_type>();
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        // looked up inside the loop, which the other threads only enter once thread 0 made the outboxes
+        auto& own_outbox = outboxes[mine];
+        auto& neighbours_outbox = outboxes[neighbours];
+        for (auto i = 0; i < num_allocations; i++) {
+            made.push_back(generator(i));
+        }
+        {
+            auto lock = std::lock_guard(own_outbox.mutex);
+            own_outbox.ptrs.insert(
+                own_outbox.ptrs.end(), std::make_move_iterator(made.begin()), std::make_move_iterator(made.end()));
+        }
+        made.clear();
+        {
+            auto lock = std::lock_guard(neighbours_outbox.mutex);
+            taken.swap(neighbours_outbox.ptrs);
+        }
+        taken.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * num_allocations);
+
+    if (state.thread_index() == 0) {
+        outboxes.clear();
+    }
+}
 
-    // std::barrier sync_point(num_threads);
-    auto threads = std::vector<std::thread>();
-    for (auto t = 0; t < num_threads; t++) {
-        threads.push_back(std::thread(
-            [&ptrs, &num_iteration, &num_copies]()
-            {
-                auto local_ptrs = std::vector<shared_ptr_type>(static_cast<size_t>(num_copies));
-                auto local_ptrs2 = std::vector<shared_ptr_type>(static_cast<size_t>(num_copies));
-                // sync_point.arrive_and_wait();
+// Thread 0 publishes a new value to an atomic every publish_every iterations and looks it up in the others, while
+// the other threads only look it up.
+template<typename AtomicT, typename FuncT, typename LookupF>
+void lookup_on_threads(benchmark::State& state, int64_t publish_every, const FuncT& generator, const LookupF& lookup)
+{
+    static auto table = std::optional<AtomicT>();
+    auto pin = cpu_pin(state.thread_index());
+    if (state.thread_index() == 0) {
+        table.emplace(generator(0));
+    }
 
-                for (uint64_t i = 0; i < static_cast<uint64_t>(num_iteration); i++) {
-                    local_ptrs.at(i % static_cast<uint64_t>(num_copies)) =
-                        ptrs.at(i % static_cast<uint64_t>(num_copies));
-                    for (uint64_t j = 0; j < static_cast<uint64_t>(num_copies); j++) {
-                        local_ptrs2.at((i * j) % static_cast<uint64_t>(num_copies)) =
-                            local_ptrs.at((i + j) % static_cast<uint64_t>(num_copies));
-                    }
-                }
+    int64_t i = 0;
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        if (state.thread_index() == 0 && i % publish_every == 0) {
+            table->store(generator(static_cast<int>(i)));
+        } else {
+            lookup(*table);
+        }
+        i++;
+    }
+    state.SetItemsProcessed(state.iterations());
 
-                // sync_point.arrive_and_wait();
-                benchmark::DoNotOptimize(local_ptrs);
-            }));
+    if (state.thread_index() == 0) {
+        table.reset();
     }
+}
+
+// readers continuously load the current snapshot while thread 0 keeps publishing new ones
+template<typename AtomicT, typename FuncT>
+void read_while_publishing(benchmark::State& state, const FuncT& generator)
+{
+    lookup_on_threads<AtomicT>(state,
+                               8,
+                               generator,
+                               [](const auto& snapshot)
+                               {
+                                   auto current = snapshot.load();
+                                   benchmark::DoNotOptimize(*current);
+                               });
+}
 
-    for (auto& thread : threads) {
-        thread.join();
+// passes ptr down depth nested calls, each taking it by value as a ParamT
+template<typename ParamT>
+auto pass_down(ParamT ptr, int64_t depth) -> int64_t
+{
+    benchmark::DoNotOptimize(ptr);
+    if (depth == 0) {
+        return *ptr;
     }
+    return pass_down<ParamT>(ptr, depth - 1) + 1;
+}
+
+template<typename ParamT, typename FuncT>
+void call_chain(int64_t depth, const FuncT& generator)
+{
+    auto ptr = generator();
+    benchmark::DoNotOptimize(pass_down<ParamT>(ptr, depth));
 }
 
+// payload of the intrusive_ptr benchmarks, which carries its own count
+template<template<typename> typename CountedT>
+struct intrusive_value : CountedT<intrusive_value<CountedT>>
+{
+    int64_t value;
+
+    explicit intrusive_value(int64_t initial_value)
+        : value(initial_value)
+    {
+    }
+
+    operator int64_t() const noexcept  // NOLINT(google-explicit-constructor)
+    {
+        return this->value;
+    }
+};
+
+using intrusive_local = intrusive_value<wind::local_counted>;
+using intrusive_atomic = intrusive_value<wind::atomic_counted>;
+using intrusive_bias = intrusive_value<wind::bias_counted>;
+
+// payload with a destructor, so its control block keeps a manager unlike one holding a plain int64_t
+struct non_trivial_value
+{
+    int64_t value;
+
+    explicit non_trivial_value(int64_t initial_value)
+        : value(initial_value)
+    {
+    }
+
+    non_trivial_value(const non_trivial_value&) = default;
+    non_trivial_value(non_trivial_value&&) = default;
+    auto operator=(const non_trivial_value&) -> non_trivial_value& = default;
+    auto operator=(non_trivial_value&&) -> non_trivial_value& = default;
+
+    ~non_trivial_value()
+    {
+        benchmark::DoNotOptimize(this->value);
+    }
+};
+
+// size of the control block make_shared allocates for T
+template<typename Policy, typename T>
+constexpr auto control_block_size = sizeof(wind::detail::control_block_with_data<typename Policy::control_block, T>);
+
 // Specific benchmarks
 
+// ===== thread_local_storage =====
+
+static void bm_thread_local_storage_lookup(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    using storage = wind::thread_local_storage<size_t>;
+
+    auto keys = std::vector<storage::key_t>();
+    for (auto i = 0; i < state.range(0); i++) {
+        keys.push_back(storage::create_key(1));
+    }
+
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        for (auto key : keys) {
+            auto [counter, already_existed] = storage::get_or_create(key, 0);
+            counter.get()++;
+            benchmark::DoNotOptimize(already_existed);
+        }
+    }
+
+    for (auto key : keys) {
+        storage::return_key(key);
+        storage::destroy_key(key);
+    }
+}
+
+static void bm_thread_local_storage_create_and_return(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    using storage = wind::thread_local_storage<size_t>;
+
+    auto keys = std::vector<storage::key_t>(static_cast<size_t>(state.range(0)));
+
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        for (auto& key : keys) {
+            key = storage::create_key(1);
+        }
+        for (auto key : keys) {
+            storage::return_key(key);
+            storage::destroy_key(key);
+        }
+        benchmark::DoNotOptimize(keys);
+    }
+}
+
 // ===== copying =====
 
 static void bm_copying_local(benchmark::State& state)
 {
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
     // NOLINTNEXTLINE
     for (auto _ : state) {
         copying(state.range(0), []() { return wind::local::make_shared<int64_t>(42); });
@@ -119,167 +537,1784 @@ static void bm_copying_local(benchmark::State& state)
 
 static void bm_copying_bias(benchmark::State& state)
 {
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
     // NOLINTNEXTLINE
     for (auto _ : state) {
         copying(state.range(0), []() { return wind::bias::make_shared<int64_t>(42); });
     }
 }
 
+static void bm_copying_owner_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copying(state.range(0), []() { return wind::owner_bias::make_shared<int64_t>(42); });
+    }
+}
+
 static void bm_copying_std(benchmark::State& state)
 {
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
     // NOLINTNEXTLINE
     for (auto _ : state) {
         copying(state.range(0), []() { return std::make_shared<int64_t>(42); });
     }
 }
 
-// ===== copy_and_release =====
+static void bm_copying_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copying(state.range(0), []() { return wind::atomic::make_shared<int64_t>(42); });
+    }
+}
 
-static void bm_copy_and_release_local(benchmark::State& state)
+static void bm_copying_naive(benchmark::State& state)
 {
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
     // NOLINTNEXTLINE
     for (auto _ : state) {
-        copy_and_release(state.range(0), 128, [](auto i) { return wind::local::make_shared<int64_t>(i * 2); });
+        copying(state.range(0), []() { return reference::naive::make_shared<int64_t>(42); });
     }
 }
 
-static void bm_copy_and_release_bias(benchmark::State& state)
+static void bm_copying_locked(benchmark::State& state)
 {
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
     // NOLINTNEXTLINE
     for (auto _ : state) {
-        copy_and_release(state.range(0), 128, [](auto i) { return wind::bias::make_shared<int64_t>(i * 2); });
+        copying(state.range(0), []() { return reference::locked::make_shared<int64_t>(42); });
     }
 }
 
-static void bm_copy_and_release_std(benchmark::State& state)
+static void bm_copying_intrusive_local(benchmark::State& state)
 {
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
     // NOLINTNEXTLINE
     for (auto _ : state) {
-        copy_and_release(state.range(0), 128, [](auto i) { return std::make_shared<int64_t>(i * 2); });
+        copying(state.range(0), []() { return wind::make_intrusive<intrusive_local>(42); });
     }
 }
 
-// =====  copy_and_release_many =====
+static void bm_copying_intrusive_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copying(state.range(0), []() { return wind::make_intrusive<intrusive_atomic>(42); });
+    }
+}
 
-static void bm_copy_and_release_many_local(benchmark::State& state)
+static void bm_copying_intrusive_bias(benchmark::State& state)
 {
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
     // NOLINTNEXTLINE
     for (auto _ : state) {
-        copy_and_release_many(state.range(0), 128, [](auto i) { return wind::local::make_shared<int64_t>(i * 2); });
+        copying(state.range(0), []() { return wind::make_intrusive<intrusive_bias>(42); });
     }
 }
 
-static void bm_copy_and_release_many_bias(benchmark::State& state)
+// ===== dereferencing =====
+
+static void bm_dereferencing_local(benchmark::State& state)
 {
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
     // NOLINTNEXTLINE
     for (auto _ : state) {
-        copy_and_release_many(state.range(0), 128, [](auto i) { return wind::bias::make_shared<int64_t>(i * 2); });
+        dereferencing(state.range(0), []() { return wind::local::make_shared<int64_t>(42); });
     }
 }
 
-static void bm_copy_and_release_many_std(benchmark::State& state)
+static void bm_dereferencing_bias(benchmark::State& state)
 {
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
     // NOLINTNEXTLINE
     for (auto _ : state) {
-        copy_and_release_many(state.range(0), 128, [](auto i) { return std::make_shared<int64_t>(i * 2); });
+        dereferencing(state.range(0), []() { return wind::bias::make_shared<int64_t>(42); });
     }
 }
 
-// =====  push_continuously_to_vector =====
+static void bm_dereferencing_owner_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        dereferencing(state.range(0), []() { return wind::owner_bias::make_shared<int64_t>(42); });
+    }
+}
 
-static void bm_push_continuously_to_vector_local(benchmark::State& state)
+static void bm_dereferencing_std(benchmark::State& state)
 {
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
     // NOLINTNEXTLINE
     for (auto _ : state) {
-        push_continuously_to_vector(state.range(0), [](auto i) { return wind::local::make_shared<int64_t>(i * 2); });
+        dereferencing(state.range(0), []() { return std::make_shared<int64_t>(42); });
     }
 }
 
-static void bm_push_continuously_to_vector_bias(benchmark::State& state)
+static void bm_dereferencing_atomic(benchmark::State& state)
 {
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
     // NOLINTNEXTLINE
     for (auto _ : state) {
-        push_continuously_to_vector(state.range(0), [](auto i) { return wind::bias::make_shared<int64_t>(i * 2); });
+        dereferencing(state.range(0), []() { return wind::atomic::make_shared<int64_t>(42); });
     }
 }
 
-static void bm_push_continuously_to_vector_std(benchmark::State& state)
+static void bm_dereferencing_naive(benchmark::State& state)
 {
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
     // NOLINTNEXTLINE
     for (auto _ : state) {
-        push_continuously_to_vector(state.range(0), [](auto i) { return std::make_shared<int64_t>(i * 2); });
+        dereferencing(state.range(0), []() { return reference::naive::make_shared<int64_t>(42); });
     }
 }
 
-// ===== copy_back_and_forth_between_threads =====
+static void bm_dereferencing_locked(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        dereferencing(state.range(0), []() { return reference::locked::make_shared<int64_t>(42); });
+    }
+}
 
-static void bm_copy_back_and_forth_between_threads_many_threads_many_copies_bias(benchmark::State& state)
+static void bm_dereferencing_intrusive_local(benchmark::State& state)
 {
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
     // NOLINTNEXTLINE
     for (auto _ : state) {
-        copy_back_and_forth_between_threads(
-            state.range(0), 128, 128, [](auto i) { return wind::bias::make_shared<int64_t>(i * 2); });
+        dereferencing(state.range(0), []() { return wind::make_intrusive<intrusive_local>(42); });
     }
 }
 
-static void bm_copy_back_and_forth_between_threads_many_threads_many_copies_std(benchmark::State& state)
+static void bm_dereferencing_intrusive_atomic(benchmark::State& state)
 {
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
     // NOLINTNEXTLINE
     for (auto _ : state) {
-        copy_back_and_forth_between_threads(
-            state.range(0), 128, 128, [](auto i) { return std::make_shared<int64_t>(i * 2); });
+        dereferencing(state.range(0), []() { return wind::make_intrusive<intrusive_atomic>(42); });
     }
 }
 
-static void bm_copy_back_and_forth_between_threads_many_threads_few_copies_bias(benchmark::State& state)
+static void bm_dereferencing_intrusive_bias(benchmark::State& state)
 {
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
     // NOLINTNEXTLINE
     for (auto _ : state) {
-        copy_back_and_forth_between_threads(
-            state.range(0), 2, 128, [](auto i) { return wind::bias::make_shared<int64_t>(i * 2); });
+        dereferencing(state.range(0), []() { return wind::make_intrusive<intrusive_bias>(42); });
     }
 }
 
-static void bm_copy_back_and_forth_between_threads_many_threads_few_copies_std(benchmark::State& state)
+// ===== locking =====
+
+static void bm_locking_local(benchmark::State& state)
 {
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
     // NOLINTNEXTLINE
     for (auto _ : state) {
-        copy_back_and_forth_between_threads(
-            state.range(0), 2, 128, [](auto i) { return std::make_shared<int64_t>(i * 2); });
+        locking<wind::local::weak_ptr<int64_t>>(state.range(0),
+                                                []() { return wind::local::make_shared<int64_t>(42); });
     }
 }
 
-// Register benchmarks
+static void bm_locking_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        locking<wind::bias::weak_ptr<int64_t>>(state.range(0), []() { return wind::bias::make_shared<int64_t>(42); });
+    }
+}
 
-BENCHMARK(bm_copying_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
-BENCHMARK(bm_copying_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
-BENCHMARK(bm_copying_std)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+static void bm_locking_std(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        locking<std::weak_ptr<int64_t>>(state.range(0), []() { return std::make_shared<int64_t>(42); });
+    }
+}
 
-BENCHMARK(bm_copy_and_release_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
-BENCHMARK(bm_copy_and_release_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
-BENCHMARK(bm_copy_and_release_std)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+static void bm_locking_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        locking<wind::atomic::weak_ptr<int64_t>>(
+            state.range(0), []() { return wind::atomic::make_shared<int64_t>(42); });
+    }
+}
 
-BENCHMARK(bm_copy_and_release_many_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
-BENCHMARK(bm_copy_and_release_many_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
-BENCHMARK(bm_copy_and_release_many_std)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+static void bm_locking_naive(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        locking<reference::naive::weak_ptr<int64_t>>(
+            state.range(0), []() { return reference::naive::make_shared<int64_t>(42); });
+    }
+}
 
-BENCHMARK(bm_push_continuously_to_vector_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
-BENCHMARK(bm_push_continuously_to_vector_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
-BENCHMARK(bm_push_continuously_to_vector_std)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+static void bm_locking_locked(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        locking<reference::locked::weak_ptr<int64_t>>(
+            state.range(0), []() { return reference::locked::make_shared<int64_t>(42); });
+    }
+}
+
+// ===== copy_and_release =====
+
+static void bm_copy_and_release_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release(state.range(0), 128, [](auto i) { return wind::local::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_copy_and_release_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release(state.range(0), 128, [](auto i) { return wind::bias::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_copy_and_release_owner_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release(state.range(0), 128, [](auto i) { return wind::owner_bias::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_copy_and_release_std(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release(state.range(0), 128, [](auto i) { return std::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_copy_and_release_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release(state.range(0), 128, [](auto i) { return wind::atomic::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_copy_and_release_naive(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release(state.range(0), 128, [](auto i) { return reference::naive::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_copy_and_release_locked(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release(state.range(0), 128, [](auto i) { return reference::locked::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_copy_and_release_intrusive_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release(state.range(0), 128, [](auto i) { return wind::make_intrusive<intrusive_local>(i * 2); });
+    }
+}
+
+static void bm_copy_and_release_intrusive_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release(state.range(0), 128, [](auto i) { return wind::make_intrusive<intrusive_atomic>(i * 2); });
+    }
+}
+
+static void bm_copy_and_release_intrusive_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release(state.range(0), 128, [](auto i) { return wind::make_intrusive<intrusive_bias>(i * 2); });
+    }
+}
+
+// ===== make_and_release =====
+
+static void bm_make_and_release_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        make_and_release(state.range(0), [](auto i) { return wind::local::make_shared<int64_t>(i); });
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["control_block_bytes"] = control_block_size<wind::local::counting_policy, int64_t>;
+}
+
+static void bm_make_and_release_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        make_and_release(state.range(0), [](auto i) { return wind::bias::make_shared<int64_t>(i); });
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["control_block_bytes"] = control_block_size<wind::bias::counting_policy, int64_t>;
+}
+
+static void bm_make_and_release_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        make_and_release(state.range(0), [](auto i) { return wind::atomic::make_shared<int64_t>(i); });
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["control_block_bytes"] = control_block_size<wind::atomic::counting_policy, int64_t>;
+}
+
+static void bm_make_and_release_naive(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        make_and_release(state.range(0), [](auto i) { return reference::naive::make_shared<int64_t>(i); });
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["control_block_bytes"] = control_block_size<reference::naive::counting_policy, int64_t>;
+}
+
+static void bm_make_and_release_locked(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        make_and_release(state.range(0), [](auto i) { return reference::locked::make_shared<int64_t>(i); });
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["control_block_bytes"] = control_block_size<reference::locked::counting_policy, int64_t>;
+}
+
+static void bm_make_and_release_intrusive_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        make_and_release(state.range(0), [](auto i) { return wind::make_intrusive<intrusive_atomic>(i); });
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void bm_make_and_release_compact(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        make_and_release(state.range(0), [](auto i) { return wind::compact::make_shared<int64_t>(i); });
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["control_block_bytes"] = control_block_size<wind::compact::counting_policy, int64_t>;
+}
+
+static void bm_make_and_release_std(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        make_and_release(state.range(0), [](auto i) { return std::make_shared<int64_t>(i); });
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void bm_make_and_release_non_trivial_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        make_and_release(state.range(0), [](auto i) { return wind::local::make_shared<non_trivial_value>(i); });
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["control_block_bytes"] = control_block_size<wind::local::counting_policy, non_trivial_value>;
+}
+
+static void bm_make_and_release_non_trivial_std(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        make_and_release(state.range(0), [](auto i) { return std::make_shared<non_trivial_value>(i); });
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// ===== footprint =====
+
+static void bm_footprint_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bytes = 0.0;
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        bytes = bytes_per_object(
+            state.range(0),
+            [](auto i) { return wind::local::allocate_shared<int64_t>(counting_allocator<int64_t>(), i); });
+    }
+    state.counters["bytes_per_object"] = bytes;
+}
+
+static void bm_footprint_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    auto bytes = 0.0;
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        bytes = bytes_per_object(
+            state.range(0),
+            [](auto i) { return wind::bias::allocate_shared<int64_t>(counting_allocator<int64_t>(), i); });
+    }
+    state.counters["bytes_per_object"] = bytes;
+}
+
+static void bm_footprint_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bytes = 0.0;
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        bytes = bytes_per_object(
+            state.range(0),
+            [](auto i) { return wind::atomic::allocate_shared<int64_t>(counting_allocator<int64_t>(), i); });
+    }
+    state.counters["bytes_per_object"] = bytes;
+}
+
+static void bm_footprint_naive(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bytes = 0.0;
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        bytes = bytes_per_object(
+            state.range(0),
+            [](auto i) { return reference::naive::allocate_shared<int64_t>(counting_allocator<int64_t>(), i); });
+    }
+    state.counters["bytes_per_object"] = bytes;
+}
+
+static void bm_footprint_locked(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bytes = 0.0;
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        bytes = bytes_per_object(
+            state.range(0),
+            [](auto i) { return reference::locked::allocate_shared<int64_t>(counting_allocator<int64_t>(), i); });
+    }
+    state.counters["bytes_per_object"] = bytes;
+}
+
+static void bm_footprint_intrusive_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bytes = 0.0;
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        bytes = bytes_per_object(state.range(0),
+                                 [](auto i)
+                                 {
+                                     // make_intrusive allocates exactly the object with new, which carries the count
+                                     counting_allocator_bytes += sizeof(intrusive_atomic);
+                                     return wind::make_intrusive<intrusive_atomic>(i);
+                                 });
+    }
+    state.counters["bytes_per_object"] = bytes;
+}
+
+static void bm_footprint_compact(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bytes = 0.0;
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        bytes = bytes_per_object(
+            state.range(0),
+            [](auto i) { return wind::compact::allocate_shared<int64_t>(counting_allocator<int64_t>(), i); });
+    }
+    state.counters["bytes_per_object"] = bytes;
+}
+
+static void bm_footprint_std(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bytes = 0.0;
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        bytes = bytes_per_object(
+            state.range(0),
+            [](auto i) { return std::allocate_shared<int64_t>(counting_allocator<int64_t>(), i); });
+    }
+    state.counters["bytes_per_object"] = bytes;
+}
+
+// =====  copy_and_release_many =====
+
+static void bm_copy_and_release_many_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release_many(state.range(0), 128, [](auto i) { return wind::local::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_copy_and_release_many_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release_many(state.range(0), 128, [](auto i) { return wind::bias::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_copy_and_release_many_owner_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release_many(
+            state.range(0), 128, [](auto i) { return wind::owner_bias::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_copy_and_release_many_std(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release_many(state.range(0), 128, [](auto i) { return std::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_copy_and_release_many_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release_many(state.range(0), 128, [](auto i) { return wind::atomic::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_copy_and_release_many_naive(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release_many(
+            state.range(0), 128, [](auto i) { return reference::naive::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_copy_and_release_many_locked(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release_many(
+            state.range(0), 128, [](auto i) { return reference::locked::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_copy_and_release_many_intrusive_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release_many(state.range(0), 128, [](auto i) { return wind::make_intrusive<intrusive_local>(i * 2); });
+    }
+}
+
+static void bm_copy_and_release_many_intrusive_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release_many(
+            state.range(0), 128, [](auto i) { return wind::make_intrusive<intrusive_atomic>(i * 2); });
+    }
+}
+
+static void bm_copy_and_release_many_intrusive_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        copy_and_release_many(state.range(0), 128, [](auto i) { return wind::make_intrusive<intrusive_bias>(i * 2); });
+    }
+}
+
+// =====  push_continuously_to_vector =====
+
+static void bm_push_continuously_to_vector_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        push_continuously_to_vector(state.range(0), [](auto i) { return wind::local::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_push_continuously_to_vector_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        push_continuously_to_vector(state.range(0), [](auto i) { return wind::bias::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_push_continuously_to_vector_owner_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        push_continuously_to_vector(state.range(0),
+                                    [](auto i) { return wind::owner_bias::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_push_continuously_to_vector_std(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        push_continuously_to_vector(state.range(0), [](auto i) { return std::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_push_continuously_to_vector_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        push_continuously_to_vector(state.range(0), [](auto i) { return wind::atomic::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_push_continuously_to_vector_naive(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        push_continuously_to_vector(
+            state.range(0), [](auto i) { return reference::naive::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_push_continuously_to_vector_locked(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        push_continuously_to_vector(
+            state.range(0), [](auto i) { return reference::locked::make_shared<int64_t>(i * 2); });
+    }
+}
+
+static void bm_push_continuously_to_vector_intrusive_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        push_continuously_to_vector(
+            state.range(0), [](auto i) { return wind::make_intrusive<intrusive_local>(i * 2); });
+    }
+}
+
+static void bm_push_continuously_to_vector_intrusive_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        push_continuously_to_vector(
+            state.range(0), [](auto i) { return wind::make_intrusive<intrusive_atomic>(i * 2); });
+    }
+}
+
+static void bm_push_continuously_to_vector_intrusive_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        push_continuously_to_vector(state.range(0), [](auto i) { return wind::make_intrusive<intrusive_bias>(i * 2); });
+    }
+}
+
+// the control blocks come from a monotonic buffer, which leaves only the cost of constructing them
+static void bm_push_continuously_to_vector_pmr_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        auto resource = std::pmr::monotonic_buffer_resource();
+        auto alloc = std::pmr::polymorphic_allocator<int64_t>(&resource);
+        push_continuously_to_vector(state.range(0),
+                                    [&alloc](auto i) { return wind::local::allocate_shared<int64_t>(alloc, i * 2); });
+    }
+}
+
+static void bm_push_continuously_to_vector_pmr_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        auto resource = std::pmr::monotonic_buffer_resource();
+        auto alloc = std::pmr::polymorphic_allocator<int64_t>(&resource);
+        push_continuously_to_vector(state.range(0),
+                                    [&alloc](auto i) { return wind::bias::allocate_shared<int64_t>(alloc, i * 2); });
+    }
+}
+
+static void bm_push_continuously_to_vector_pmr_owner_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        auto resource = std::pmr::monotonic_buffer_resource();
+        auto alloc = std::pmr::polymorphic_allocator<int64_t>(&resource);
+        push_continuously_to_vector(
+            state.range(0), [&alloc](auto i) { return wind::owner_bias::allocate_shared<int64_t>(alloc, i * 2); });
+    }
+}
+
+static void bm_push_continuously_to_vector_pmr_std(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        auto resource = std::pmr::monotonic_buffer_resource();
+        auto alloc = std::pmr::polymorphic_allocator<int64_t>(&resource);
+        push_continuously_to_vector(state.range(0),
+                                    [&alloc](auto i) { return std::allocate_shared<int64_t>(alloc, i * 2); });
+    }
+}
+
+// ===== copy_vector =====
+
+static void bm_copy_vector_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto ptrs = ptrs_over_objects(state.range(0), 8, [](auto i) { return wind::local::make_shared<int64_t>(i); });
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        auto copies = ptrs;
+        benchmark::DoNotOptimize(copies);
+    }
+}
+
+static void bm_copy_vector_batched_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto ptrs = ptrs_over_objects(state.range(0), 8, [](auto i) { return wind::local::make_shared<int64_t>(i); });
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        auto copies = wind::copy_all(ptrs);
+        benchmark::DoNotOptimize(copies);
+        wind::release_all(copies);
+    }
+}
+
+static void bm_copy_vector_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    auto ptrs = ptrs_over_objects(state.range(0), 8, [](auto i) { return wind::bias::make_shared<int64_t>(i); });
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        auto copies = ptrs;
+        benchmark::DoNotOptimize(copies);
+    }
+}
+
+static void bm_copy_vector_batched_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    auto ptrs = ptrs_over_objects(state.range(0), 8, [](auto i) { return wind::bias::make_shared<int64_t>(i); });
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        auto copies = wind::copy_all(ptrs);
+        benchmark::DoNotOptimize(copies);
+        wind::release_all(copies);
+    }
+}
+
+static void bm_copy_vector_std(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto ptrs = ptrs_over_objects(state.range(0), 8, [](auto i) { return std::make_shared<int64_t>(i); });
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        auto copies = ptrs;
+        benchmark::DoNotOptimize(copies);
+    }
+}
+
+static void bm_copy_vector_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto ptrs = ptrs_over_objects(state.range(0), 8, [](auto i) { return wind::atomic::make_shared<int64_t>(i); });
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        auto copies = ptrs;
+        benchmark::DoNotOptimize(copies);
+    }
+}
+
+static void bm_copy_vector_naive(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto ptrs = ptrs_over_objects(state.range(0), 8, [](auto i) { return reference::naive::make_shared<int64_t>(i); });
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        auto copies = ptrs;
+        benchmark::DoNotOptimize(copies);
+    }
+}
+
+static void bm_copy_vector_locked(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto ptrs = ptrs_over_objects(state.range(0), 8, [](auto i) { return reference::locked::make_shared<int64_t>(i); });
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        auto copies = ptrs;
+        benchmark::DoNotOptimize(copies);
+    }
+}
+
+static void bm_copy_vector_intrusive_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto ptrs = ptrs_over_objects(state.range(0), 8, [](auto i) { return wind::make_intrusive<intrusive_atomic>(i); });
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        auto copies = ptrs;
+        benchmark::DoNotOptimize(copies);
+    }
+}
+
+// ===== make_shared_n =====
+
+static void bm_make_shared_n_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        auto ptrs = wind::local::make_shared_n<int64_t>(static_cast<size_t>(state.range(0)), int64_t {2});
+        benchmark::DoNotOptimize(ptrs);
+    }
+}
+
+static void bm_make_shared_n_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        auto ptrs = wind::bias::make_shared_n<int64_t>(static_cast<size_t>(state.range(0)), int64_t {2});
+        benchmark::DoNotOptimize(ptrs);
+    }
+}
+
+// ===== copy_and_release_on_threads =====
+
+static void bm_copy_and_release_on_threads_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    copy_and_release_on_threads(state, [](auto i) { return wind::bias::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_copy_and_release_on_threads_owner_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    copy_and_release_on_threads(state, [](auto i) { return wind::owner_bias::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_copy_and_release_on_threads_deferred_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    wind::bias::set_release_batch_size(64);
+    copy_and_release_on_threads(state, [](auto i) { return wind::bias::make_shared<int64_t>(i * 2); });
+    wind::bias::set_release_batch_size(0);
+}
+
+static void bm_copy_and_release_on_threads_std(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    copy_and_release_on_threads(state, [](auto i) { return std::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_copy_and_release_on_threads_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    copy_and_release_on_threads(state, [](auto i) { return wind::atomic::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_copy_and_release_on_threads_naive(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    copy_and_release_on_threads(state, [](auto i) { return reference::naive::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_copy_and_release_on_threads_locked(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    copy_and_release_on_threads(state, [](auto i) { return reference::locked::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_copy_and_release_on_threads_intrusive_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    copy_and_release_on_threads(state, [](auto i) { return wind::make_intrusive<intrusive_atomic>(i * 2); });
+}
+
+static void bm_copy_and_release_on_threads_intrusive_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    copy_and_release_on_threads(state, [](auto i) { return wind::make_intrusive<intrusive_bias>(i * 2); });
+}
+
+// ===== allocate_on_threads =====
+
+static void bm_allocate_on_threads_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    allocate_on_threads(state, 1 << 12, [](auto i) { return wind::local::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_allocate_on_threads_slab_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    allocate_on_threads(
+        state,
+        1 << 12,
+        [](auto i) { return wind::local::allocate_shared<int64_t>(wind::slab_allocator<int64_t>(), i * 2); });
+}
+
+static void bm_allocate_on_threads_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    allocate_on_threads(state, 1 << 12, [](auto i) { return wind::bias::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_allocate_on_threads_owner_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    allocate_on_threads(state, 1 << 12, [](auto i) { return wind::owner_bias::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_allocate_on_threads_slab_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    allocate_on_threads(
+        state,
+        1 << 12,
+        [](auto i) { return wind::bias::allocate_shared<int64_t>(wind::slab_allocator<int64_t>(), i * 2); });
+}
+
+static void bm_allocate_on_threads_slab_owner_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    allocate_on_threads(
+        state,
+        1 << 12,
+        [](auto i) { return wind::owner_bias::allocate_shared<int64_t>(wind::slab_allocator<int64_t>(), i * 2); });
+}
+
+static void bm_allocate_on_threads_std(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    allocate_on_threads(state, 1 << 12, [](auto i) { return std::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_allocate_on_threads_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    allocate_on_threads(state, 1 << 12, [](auto i) { return wind::atomic::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_allocate_on_threads_naive(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    allocate_on_threads(state, 1 << 12, [](auto i) { return reference::naive::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_allocate_on_threads_locked(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    allocate_on_threads(state, 1 << 12, [](auto i) { return reference::locked::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_allocate_on_threads_intrusive_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    allocate_on_threads(state, 1 << 12, [](auto i) { return wind::make_intrusive<intrusive_local>(i * 2); });
+}
+
+static void bm_allocate_on_threads_intrusive_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    allocate_on_threads(state, 1 << 12, [](auto i) { return wind::make_intrusive<intrusive_atomic>(i * 2); });
+}
+
+static void bm_allocate_on_threads_intrusive_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    allocate_on_threads(state, 1 << 12, [](auto i) { return wind::make_intrusive<intrusive_bias>(i * 2); });
+}
+
+static void bm_allocate_on_threads_slab_std(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    allocate_on_threads(
+        state, 1 << 12, [](auto i) { return std::allocate_shared<int64_t>(wind::slab_allocator<int64_t>(), i * 2); });
+}
+
+static void bm_release_on_other_threads_std(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    release_on_other_threads(state, 1 << 12, [](auto i) { return std::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_release_on_other_threads_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    release_on_other_threads(state, 1 << 12, [](auto i) { return wind::atomic::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_release_on_other_threads_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    release_on_other_threads(state, 1 << 12, [](auto i) { return wind::bias::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_release_on_other_threads_naive(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    release_on_other_threads(state, 1 << 12, [](auto i) { return reference::naive::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_release_on_other_threads_locked(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    release_on_other_threads(state, 1 << 12, [](auto i) { return reference::locked::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_release_on_other_threads_intrusive_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    release_on_other_threads(state, 1 << 12, [](auto i) { return wind::make_intrusive<intrusive_atomic>(i * 2); });
+}
+
+static void bm_release_on_other_threads_intrusive_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    release_on_other_threads(state, 1 << 12, [](auto i) { return wind::make_intrusive<intrusive_bias>(i * 2); });
+}
+
+static void bm_release_on_other_threads_owner_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    release_on_other_threads(state, 1 << 12, [](auto i) { return wind::owner_bias::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_release_on_other_threads_slab_std(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    release_on_other_threads(
+        state, 1 << 12, [](auto i) { return std::allocate_shared<int64_t>(wind::slab_allocator<int64_t>(), i * 2); });
+}
+
+// ===== copy_back_and_forth_between_threads =====
+
+static void bm_copy_back_and_forth_between_threads_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // not thread safe, so every thread copies objects of its own
+    copy_back_and_forth_between_threads(state, [](auto i) { return wind::local::make_shared<int64_t>(i * 2); }, true);
+}
+
+static void bm_copy_back_and_forth_between_threads_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    copy_back_and_forth_between_threads(state, [](auto i) { return wind::bias::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_copy_back_and_forth_between_threads_owner_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    copy_back_and_forth_between_threads(state, [](auto i) { return wind::owner_bias::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_copy_back_and_forth_between_threads_deferred_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    wind::bias::set_release_batch_size(64);
+    copy_back_and_forth_between_threads(state, [](auto i) { return wind::bias::make_shared<int64_t>(i * 2); });
+    wind::bias::set_release_batch_size(0);
+}
+
+static void bm_copy_back_and_forth_between_threads_std(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    copy_back_and_forth_between_threads(state, [](auto i) { return std::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_copy_back_and_forth_between_threads_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    copy_back_and_forth_between_threads(state, [](auto i) { return wind::atomic::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_copy_back_and_forth_between_threads_naive(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    copy_back_and_forth_between_threads(state, [](auto i) { return reference::naive::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_copy_back_and_forth_between_threads_locked(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    copy_back_and_forth_between_threads(state, [](auto i) { return reference::locked::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_copy_back_and_forth_between_threads_intrusive_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    copy_back_and_forth_between_threads(state, [](auto i) { return wind::make_intrusive<intrusive_atomic>(i * 2); });
+}
+
+static void bm_copy_back_and_forth_between_threads_intrusive_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    copy_back_and_forth_between_threads(state, [](auto i) { return wind::make_intrusive<intrusive_bias>(i * 2); });
+}
+
+// ===== atomic shared_ptr =====
+
+static void bm_read_while_publishing_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    read_while_publishing<wind::bias::atomic_shared_ptr<int64_t>>(
+        state, [](auto i) { return wind::bias::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_read_while_publishing_std(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    read_while_publishing<std::atomic<std::shared_ptr<int64_t>>>(
+        state, [](auto i) { return std::make_shared<int64_t>(i * 2); });
+}
+
+static void bm_lookup_on_threads_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    lookup_on_threads<wind::bias::atomic_shared_ptr<int64_t>>(
+        state,
+        64,
+        [](auto i) { return wind::bias::make_shared<int64_t>(i * 2); },
+        [](const auto& table)
+        {
+            auto current = table.load();
+            benchmark::DoNotOptimize(*current);
+        });
+}
+
+static void bm_lookup_on_threads_guarded_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    lookup_on_threads<wind::bias::atomic_shared_ptr<int64_t>>(
+        state,
+        64,
+        [](auto i) { return wind::bias::make_shared<int64_t>(i * 2); },
+        [](const auto& table)
+        {
+            auto guard = wind::epoch::guard();
+            auto current = table.load(guard);
+            benchmark::DoNotOptimize(*current);
+        });
+}
+
+// reads the thread's cached copy, only revalidating its version
+static void bm_lookup_on_threads_rcu(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    lookup_on_threads<wind::bias::rcu_cell<int64_t>>(
+        state,
+        64,
+        [](auto i) { return wind::bias::make_shared<int64_t>(i * 2); },
+        [](const auto& table)
+        {
+            auto current = table.read();
+            benchmark::DoNotOptimize(*current);
+        });
+}
+
+static void bm_lookup_on_threads_std(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    lookup_on_threads<std::atomic<std::shared_ptr<int64_t>>>(
+        state,
+        64,
+        [](auto i) { return std::make_shared<int64_t>(i * 2); },
+        [](const auto& table)
+        {
+            auto current = table.load();
+            benchmark::DoNotOptimize(*current);
+        });
+}
+
+static void bm_call_chain_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        call_chain<wind::local::shared_ptr<int64_t>>(
+            state.range(0), []() { return wind::local::make_shared<int64_t>(42); });
+    }
+}
+
+static void bm_call_chain_borrowed_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        call_chain<wind::local::borrowed_ptr<int64_t>>(
+            state.range(0), []() { return wind::local::make_shared<int64_t>(42); });
+    }
+}
+
+static void bm_call_chain_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        call_chain<wind::bias::shared_ptr<int64_t>>(
+            state.range(0), []() { return wind::bias::make_shared<int64_t>(42); });
+    }
+}
+
+static void bm_call_chain_borrowed_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        call_chain<wind::bias::borrowed_ptr<int64_t>>(
+            state.range(0), []() { return wind::bias::make_shared<int64_t>(42); });
+    }
+}
+
+static void bm_call_chain_owner_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        call_chain<wind::owner_bias::shared_ptr<int64_t>>(
+            state.range(0), []() { return wind::owner_bias::make_shared<int64_t>(42); });
+    }
+}
+
+static void bm_call_chain_borrowed_owner_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        call_chain<wind::owner_bias::borrowed_ptr<int64_t>>(
+            state.range(0), []() { return wind::owner_bias::make_shared<int64_t>(42); });
+    }
+}
+
+static void bm_call_chain_std(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        call_chain<std::shared_ptr<int64_t>>(state.range(0), []() { return std::make_shared<int64_t>(42); });
+    }
+}
+
+static void bm_call_chain_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        call_chain<wind::atomic::shared_ptr<int64_t>>(
+            state.range(0), []() { return wind::atomic::make_shared<int64_t>(42); });
+    }
+}
+
+static void bm_call_chain_naive(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        call_chain<reference::naive::shared_ptr<int64_t>>(
+            state.range(0), []() { return reference::naive::make_shared<int64_t>(42); });
+    }
+}
+
+static void bm_call_chain_locked(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        call_chain<reference::locked::shared_ptr<int64_t>>(
+            state.range(0), []() { return reference::locked::make_shared<int64_t>(42); });
+    }
+}
+
+static void bm_call_chain_intrusive_local(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        call_chain<wind::intrusive_ptr<intrusive_local>>(
+            state.range(0), []() { return wind::make_intrusive<intrusive_local>(42); });
+    }
+}
+
+static void bm_call_chain_intrusive_atomic(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        call_chain<wind::intrusive_ptr<intrusive_atomic>>(
+            state.range(0), []() { return wind::make_intrusive<intrusive_atomic>(42); });
+    }
+}
+
+static void bm_call_chain_intrusive_bias(benchmark::State& state)
+{
+    auto allocations = allocation_counter::report(state);
+    auto hardware_events = hardware_counters::report(state);
+    auto bias_events = bias_statistics::report(state);
+    // NOLINTNEXTLINE
+    for (auto _ : state) {
+        call_chain<wind::intrusive_ptr<intrusive_bias>>(
+            state.range(0), []() { return wind::make_intrusive<intrusive_bias>(42); });
+    }
+}
+
+// Register benchmarks
+
+BENCHMARK(bm_thread_local_storage_lookup)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_thread_local_storage_create_and_return)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+
+BENCHMARK(bm_copying_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copying_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copying_owner_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copying_std)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copying_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copying_naive)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copying_locked)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copying_intrusive_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copying_intrusive_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copying_intrusive_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+
+BENCHMARK(bm_dereferencing_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_dereferencing_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_dereferencing_owner_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_dereferencing_std)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_dereferencing_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_dereferencing_naive)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_dereferencing_locked)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_dereferencing_intrusive_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_dereferencing_intrusive_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_dereferencing_intrusive_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+
+BENCHMARK(bm_locking_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_locking_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_locking_std)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_locking_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_locking_naive)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_locking_locked)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+
+BENCHMARK(bm_copy_and_release_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_and_release_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_and_release_owner_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_and_release_std)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_and_release_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_and_release_naive)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_and_release_locked)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_and_release_intrusive_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_and_release_intrusive_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_and_release_intrusive_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+
+BENCHMARK(bm_make_and_release_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_make_and_release_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_make_and_release_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_make_and_release_naive)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_make_and_release_locked)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_make_and_release_intrusive_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_make_and_release_compact)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_make_and_release_std)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_make_and_release_non_trivial_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_make_and_release_non_trivial_std)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+
+BENCHMARK(bm_footprint_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_footprint_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_footprint_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_footprint_naive)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_footprint_locked)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_footprint_intrusive_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_footprint_compact)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_footprint_std)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+
+BENCHMARK(bm_copy_and_release_many_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_and_release_many_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_and_release_many_owner_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_and_release_many_std)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_and_release_many_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_and_release_many_naive)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_and_release_many_locked)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_and_release_many_intrusive_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_and_release_many_intrusive_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_and_release_many_intrusive_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+
+BENCHMARK(bm_push_continuously_to_vector_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_push_continuously_to_vector_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_push_continuously_to_vector_owner_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_push_continuously_to_vector_std)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_push_continuously_to_vector_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_push_continuously_to_vector_naive)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_push_continuously_to_vector_locked)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_push_continuously_to_vector_intrusive_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_push_continuously_to_vector_intrusive_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_push_continuously_to_vector_intrusive_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_push_continuously_to_vector_pmr_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_push_continuously_to_vector_pmr_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_push_continuously_to_vector_pmr_owner_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_push_continuously_to_vector_pmr_std)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_vector_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_vector_batched_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_vector_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_vector_batched_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_vector_std)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_vector_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_vector_naive)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_vector_locked)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_copy_vector_intrusive_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_make_shared_n_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_make_shared_n_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+
+BENCHMARK(bm_copy_and_release_on_threads_bias)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_copy_and_release_on_threads_owner_bias)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_copy_and_release_on_threads_deferred_bias)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_copy_and_release_on_threads_std)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_copy_and_release_on_threads_atomic)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_copy_and_release_on_threads_naive)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_copy_and_release_on_threads_locked)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_copy_and_release_on_threads_intrusive_atomic)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_copy_and_release_on_threads_intrusive_bias)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+
+BENCHMARK(bm_allocate_on_threads_local)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_allocate_on_threads_slab_local)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_allocate_on_threads_bias)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_allocate_on_threads_owner_bias)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_allocate_on_threads_slab_bias)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_allocate_on_threads_slab_owner_bias)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_allocate_on_threads_std)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_allocate_on_threads_atomic)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_allocate_on_threads_naive)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_allocate_on_threads_locked)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_allocate_on_threads_intrusive_local)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_allocate_on_threads_intrusive_atomic)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_allocate_on_threads_intrusive_bias)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_allocate_on_threads_slab_std)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+
+BENCHMARK(bm_release_on_other_threads_std)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_release_on_other_threads_atomic)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_release_on_other_threads_bias)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_release_on_other_threads_naive)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_release_on_other_threads_locked)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_release_on_other_threads_intrusive_atomic)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_release_on_other_threads_intrusive_bias)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_release_on_other_threads_slab_std)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_release_on_other_threads_owner_bias)->ThreadRange(1, 64)->UseRealTime();  // NOLINT
+
+// sweeps the copies per thread and the number of threads
+BENCHMARK(bm_copy_back_and_forth_between_threads_local)  // NOLINT
+    ->RangeMultiplier(8)
+    ->Range(2, 128)
+    ->ThreadRange(1, 128)
+    ->UseRealTime();
+BENCHMARK(bm_copy_back_and_forth_between_threads_bias)  // NOLINT
+    ->RangeMultiplier(8)
+    ->Range(2, 128)
+    ->ThreadRange(1, 128)
+    ->UseRealTime();
+BENCHMARK(bm_copy_back_and_forth_between_threads_owner_bias)  // NOLINT
+    ->RangeMultiplier(8)
+    ->Range(2, 128)
+    ->ThreadRange(1, 128)
+    ->UseRealTime();
+BENCHMARK(bm_copy_back_and_forth_between_threads_deferred_bias)  // NOLINT
+    ->RangeMultiplier(8)
+    ->Range(2, 128)
+    ->ThreadRange(1, 128)
+    ->UseRealTime();
+BENCHMARK(bm_copy_back_and_forth_between_threads_std)  // NOLINT
+    ->RangeMultiplier(8)
+    ->Range(2, 128)
+    ->ThreadRange(1, 128)
+    ->UseRealTime();
+BENCHMARK(bm_copy_back_and_forth_between_threads_atomic)  // NOLINT
+    ->RangeMultiplier(8)
+    ->Range(2, 128)
+    ->ThreadRange(1, 128)
+    ->UseRealTime();
+BENCHMARK(bm_copy_back_and_forth_between_threads_naive)  // NOLINT
+    ->RangeMultiplier(8)
+    ->Range(2, 128)
+    ->ThreadRange(1, 128)
+    ->UseRealTime();
+BENCHMARK(bm_copy_back_and_forth_between_threads_locked)  // NOLINT
+    ->RangeMultiplier(8)
+    ->Range(2, 128)
+    ->ThreadRange(1, 128)
+    ->UseRealTime();
+BENCHMARK(bm_copy_back_and_forth_between_threads_intrusive_atomic)  // NOLINT
+    ->RangeMultiplier(8)
+    ->Range(2, 128)
+    ->ThreadRange(1, 128)
+    ->UseRealTime();
+BENCHMARK(bm_copy_back_and_forth_between_threads_intrusive_bias)  // NOLINT
+    ->RangeMultiplier(8)
+    ->Range(2, 128)
+    ->ThreadRange(1, 128)
+    ->UseRealTime();
+
+BENCHMARK(bm_read_while_publishing_bias)->ThreadRange(2, 64)->UseRealTime();  // NOLINT
+BENCHMARK(bm_read_while_publishing_std)->ThreadRange(2, 64)->UseRealTime();  // NOLINT
+
+BENCHMARK(bm_lookup_on_threads_bias)->ThreadRange(1, 128)->UseRealTime();  // NOLINT
+BENCHMARK(bm_lookup_on_threads_guarded_bias)->ThreadRange(1, 128)->UseRealTime();  // NOLINT
+BENCHMARK(bm_lookup_on_threads_rcu)->ThreadRange(1, 128)->UseRealTime();  // NOLINT
+BENCHMARK(bm_lookup_on_threads_std)->ThreadRange(1, 128)->UseRealTime();  // NOLINT
+
+BENCHMARK(bm_call_chain_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_call_chain_borrowed_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_call_chain_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_call_chain_borrowed_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_call_chain_owner_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_call_chain_borrowed_owner_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_call_chain_std)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_call_chain_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_call_chain_naive)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_call_chain_locked)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_call_chain_intrusive_local)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_call_chain_intrusive_atomic)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
+BENCHMARK(bm_call_chain_intrusive_bias)->RangeMultiplier(2)->Range(1 << 4, 1 << 12);  // NOLINT
 
-// local ofcourse does not work
-BENCHMARK(bm_copy_back_and_forth_between_threads_many_threads_many_copies_bias)  // NOLINT
-    ->RangeMultiplier(2)
-    ->Range(1 << 4, 1 << 12);
-BENCHMARK(bm_copy_back_and_forth_between_threads_many_threads_many_copies_std)  // NOLINT
-    ->RangeMultiplier(2)
-    ->Range(1 << 4, 1 << 12);
-
-BENCHMARK(bm_copy_back_and_forth_between_threads_many_threads_few_copies_bias)  // NOLINT
-    ->RangeMultiplier(2)
-    ->Range(1 << 4, 1 << 12);
-BENCHMARK(bm_copy_back_and_forth_between_threads_many_threads_few_copies_std)  // NOLINT
-    ->RangeMultiplier(2)
-    ->Range(1 << 4, 1 << 12);
-
-BENCHMARK_MAIN();  // NOLINT
\ No newline at end of file
+BENCHMARK_MAIN();  // NOLINT
@@ -0,0 +1,130 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+#include <shared_ptr/basic_shared_ptr.hpp>
+
+namespace wind::atomic
+{
+namespace detail
+{
+struct control_block : wind::detail::managed_control_block<control_block>
+{
+    std::atomic<size_t> counter {1};
+    // number of weak_ptrs, plus one while counter is non-zero
+    std::atomic<size_t> weak_counter {1};
+
+    control_block() noexcept = default;
+    control_block(const control_block&) = delete;
+    control_block(control_block&&) = delete;
+    auto operator=(const control_block&) -> control_block& = delete;
+    auto operator=(control_block&&) -> control_block& = delete;
+
+    void inc_weak() noexcept
+    {
+        this->weak_counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] auto decrement_weak_and_check_zero() noexcept -> bool
+    {
+        return this->weak_counter.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    void release_data() noexcept
+    {
+        this->destroy_data();
+        if (this->decrement_weak_and_check_zero()) {
+            this->deallocate();
+        }
+    }
+};
+
+}  // namespace detail
+
+// one atomic counter shared by all threads, like std::shared_ptr
+struct counting_policy
+{
+    using control_block = detail::control_block;
+
+    struct handle
+    {
+    };
+
+    [[nodiscard]] static auto handle_of(control_block* /*control*/) noexcept -> handle
+    {
+        return {};
+    }
+
+    static void add_reference(control_block* control, handle /*handle*/) noexcept
+    {
+        control->counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void release_reference(control_block* control, handle /*handle*/) noexcept
+    {
+        if (control->counter.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            control->release_data();
+        }
+    }
+
+    static void add_references(control_block* control, handle /*handle*/, size_t count) noexcept
+    {
+        control->counter.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    static void release_references(control_block* control, handle /*handle*/, size_t count) noexcept
+    {
+        if (control->counter.fetch_sub(count, std::memory_order_acq_rel) == count) {
+            control->release_data();
+        }
+    }
+
+    [[nodiscard]] static auto try_add_reference(control_block* control) noexcept -> bool
+    {
+        auto count = control->counter.load(std::memory_order_relaxed);
+        while (count != 0) {
+            if (control->counter.compare_exchange_weak(count, count + 1, std::memory_order_acquire)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    [[nodiscard]] static auto use_count(const control_block* control) noexcept -> size_t
+    {
+        return control->counter.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static auto expired(const control_block* control) noexcept -> bool
+    {
+        return control->counter.load() == 0;
+    }
+
+    [[nodiscard]] static auto unique(const control_block* control, handle /*handle*/) noexcept -> bool
+    {
+        return control->counter.load() == 1;
+    }
+};
+
+template<typename T>
+using shared_ptr = basic_shared_ptr<T, counting_policy>;
+
+template<typename T>
+using weak_ptr = basic_weak_ptr<T, counting_policy>;
+
+template<typename T>
+using borrowed_ptr = basic_borrowed_ptr<T, counting_policy>;
+
+template<typename T>
+using enable_shared_from_this = basic_enable_shared_from_this<T, counting_policy>;
+
+template<typename T>
+inline constexpr wind::detail::make_shared_function<T, counting_policy> make_shared {};
+
+template<typename T>
+inline constexpr wind::detail::make_shared_n_function<T, counting_policy> make_shared_n {};
+
+template<typename T>
+inline constexpr wind::detail::allocate_shared_function<T, counting_policy> allocate_shared {};
+
+}  // namespace wind::atomic
@@ -0,0 +1,1385 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <shared_ptr/slab_allocator.hpp>
+
+namespace wind
+{
+// shared_ptr, weak_ptr, borrowed_ptr and enable_shared_from_this for any counting policy. The policy decides at compile
+// time how references are counted, and provides:
+//
+//  - control_block: the base of all control blocks, derived from detail::managed_control_block<control_block>, with
+//    inc_weak(), decrement_weak_and_check_zero() and release_data()
+//  - handle: what a shared_ptr caches about its control block next to the pointer, an empty type if nothing
+//  - handle_of(control): the handle of a control block
+//  - add_reference(control, handle) and release_reference(control, handle): counts a new copy or drops one, releasing
+//    the object with the last one
+//  - try_add_reference(control): counts a new copy unless the object is already gone, for weak_ptr::lock
+//  - use_count(control), expired(control) and unique(control, handle)
+//  - optionally add_references(control, handle, count) and release_references(control, handle, count): the same for
+//    count copies at once, with which copy_all and release_all count the copies of each object in a range together
+//  - optionally copy_batch and release_batch: types whose add(control, handle) counts a copy or drops one, and which
+//    copy_all and release_all use for a range instead, for policies with work to share across different objects
+//
+// A newly created control block counts one reference, which goes to the first shared_ptr.
+template<typename T, typename Policy>
+struct basic_shared_ptr;
+
+template<typename T, typename Policy>
+struct basic_weak_ptr;
+
+template<typename T, typename Policy>
+struct basic_borrowed_ptr;
+
+template<typename T, typename Policy>
+struct basic_enable_shared_from_this;
+
+namespace detail
+{
+enum class block_operation
+{
+    destroy_data,
+    deallocate,
+    get_data,
+};
+
+// Control blocks are type-erased through a single function pointer rather than a vtable. It stays null for trivially
+// destructible values stored right behind the control block by make_shared, whose release then calls nothing
+// indirectly and frees the block directly.
+template<typename Block>
+struct managed_control_block
+{
+    using manager = void* (*)(Block* block, block_operation operation) noexcept;
+
+    manager manage {nullptr};
+
+    // destroys the managed object, the control block itself stays alive for the weak_ptrs
+    void destroy_data() noexcept
+    {
+        if (this->manage != nullptr) {
+            this->manage(this->block(), block_operation::destroy_data);
+        }
+    }
+
+    // frees the control block itself, once the weak counter reached zero
+    void deallocate() noexcept
+    {
+        if (this->manage != nullptr) {
+            this->manage(this->block(), block_operation::deallocate);
+            return;
+        }
+        auto* control = this->block();
+        std::destroy_at(control);
+#ifdef WIND_SHARED_PTR_SLAB_ALLOCATOR
+        // make_shared only leaves blocks unmanaged that fit a slab, whose pool frees them without knowing their size
+        slab_pool::deallocate(control);
+#else
+        ::operator delete(control);
+#endif
+    }
+
+    // the object owned by the control block, which is not necessarily the pointer held by a shared_ptr
+    [[nodiscard]] auto get_data() noexcept -> void*
+    {
+        if (this->manage != nullptr) {
+            return this->manage(this->block(), block_operation::get_data);
+        }
+        return reinterpret_cast<std::byte*>(this->block()) + sizeof(Block);  // NOLINT
+    }
+
+    // the manager of a control block type, forwarding to its own destroy_data(), deallocate() and get_data()
+    template<typename Derived>
+    static auto manager_of(Block* block, block_operation operation) noexcept -> void*
+    {
+        auto* derived = static_cast<Derived*>(block);
+        if (operation == block_operation::destroy_data) {
+            derived->destroy_data();
+        } else if (operation == block_operation::deallocate) {
+            derived->deallocate();
+        } else {
+            return derived->get_data();
+        }
+        return nullptr;
+    }
+
+  private:
+    [[nodiscard]] auto block() noexcept -> Block*
+    {
+        return static_cast<Block*>(this);
+    }
+};
+
+template<typename Base, typename T, typename DeleterF>
+struct control_block_with_deleter final : Base
+{
+    T* data;
+    // takes no space for stateless deleters like std::default_delete
+    [[no_unique_address]] DeleterF deleter;
+
+    control_block_with_deleter(T* i_data, DeleterF i_deleter) noexcept
+        : data {i_data}
+        , deleter {std::move(i_deleter)}
+    {
+        this->manage = &Base::template manager_of<control_block_with_deleter>;
+    }
+
+    control_block_with_deleter(const control_block_with_deleter&) = delete;
+    control_block_with_deleter(control_block_with_deleter&&) = delete;
+    auto operator=(const control_block_with_deleter&) -> control_block_with_deleter& = delete;
+    auto operator=(control_block_with_deleter&&) -> control_block_with_deleter& = delete;
+
+    ~control_block_with_deleter() noexcept = default;
+
+    void destroy_data() noexcept
+    {
+        this->deleter(this->data);
+    }
+
+    void deallocate() noexcept
+    {
+        delete this;
+    }
+
+    [[nodiscard]] auto get_data() noexcept -> void*
+    {
+        return const_cast<std::remove_cv_t<T>*>(this->data);  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    }
+};
+
+template<typename Base, typename T, typename DeleterF>
+auto new_control_block_with_deleter(T* ptr, DeleterF&& deleter)
+{
+    return new control_block_with_deleter<Base, T, std::decay_t<DeleterF>>(  // NOLINT
+        ptr,
+        std::forward<DeleterF>(deleter));
+}
+
+template<typename Base, typename T>
+struct control_block_with_data final : Base
+{
+#ifdef WIND_SHARED_PTR_SLAB_ALLOCATOR
+    // the block is drawn from the slab pools, where it has to fit to be freed without a manager
+    static constexpr bool fits_unmanaged =
+        sizeof(Base) + sizeof(T) <= slab_pool::max_size && alignof(Base) <= slab_pool::granularity;
+#else
+    static constexpr bool fits_unmanaged = true;
+#endif
+    // needs no manager, the value directly follows the control block and is freed with it
+    static constexpr bool unmanaged =
+        std::is_trivially_destructible_v<T> && alignof(T) <= alignof(Base) && fits_unmanaged;
+
+    // in a union so the value can be destroyed before the control block
+    union
+    {
+        T val;
+    };
+
+    template<typename... Args>
+    explicit control_block_with_data(Args&&... args) noexcept
+        : val {std::forward<Args>(args)...}
+    {
+        if constexpr (!unmanaged) {
+            this->manage = &Base::template manager_of<control_block_with_data>;
+        }
+    }
+
+    control_block_with_data(const control_block_with_data&) = delete;
+    control_block_with_data(control_block_with_data&&) = delete;
+    auto operator=(const control_block_with_data&) -> control_block_with_data& = delete;
+    auto operator=(control_block_with_data&&) -> control_block_with_data& = delete;
+
+    ~control_block_with_data() noexcept {}  // NOLINT(modernize-use-equals-default)
+
+    void destroy_data() noexcept
+    {
+        std::destroy_at(&this->val);
+    }
+
+    void deallocate() noexcept
+    {
+#ifdef WIND_SHARED_PTR_SLAB_ALLOCATOR
+        std::destroy_at(this);
+        slab_allocator<control_block_with_data>().deallocate(this, 1);
+#else
+        delete this;
+#endif
+    }
+
+    [[nodiscard]] auto get_data() noexcept -> void*
+    {
+        return const_cast<std::remove_cv_t<T>*>(&this->val);  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    }
+};
+
+// with WIND_SHARED_PTR_SLAB_ALLOCATOR defined, the block comes from the per-thread slab pools
+template<typename Base, typename T, typename... Args>
+auto new_control_block_with_data(Args&&... args)
+{
+#ifdef WIND_SHARED_PTR_SLAB_ALLOCATOR
+    auto* block = std::construct_at(slab_allocator<control_block_with_data<Base, T>>().allocate(1),
+                                    std::forward<Args>(args)...);
+#else
+    auto* block = new control_block_with_data<Base, T>(std::forward<Args>(args)...);  // NOLINT
+#endif
+    if constexpr (control_block_with_data<Base, T>::unmanaged) {
+        // the control block leaves no tail padding the value could be placed in
+        assert(static_cast<Base*>(block)->get_data() == block->get_data());
+    }
+    return block;
+}
+
+// The elements of an array follow the control block in the same allocation.
+template<typename Base, typename T>
+struct control_block_with_array final : Base
+{
+    size_t size;
+
+    explicit control_block_with_array(size_t i_size) noexcept
+        : size {i_size}
+    {
+        this->manage = &Base::template manager_of<control_block_with_array>;
+    }
+
+    control_block_with_array(const control_block_with_array&) = delete;
+    control_block_with_array(control_block_with_array&&) = delete;
+    auto operator=(const control_block_with_array&) -> control_block_with_array& = delete;
+    auto operator=(control_block_with_array&&) -> control_block_with_array& = delete;
+
+    ~control_block_with_array() noexcept = default;
+
+    static constexpr size_t alignment =
+        alignof(control_block_with_array) > alignof(T) ? alignof(control_block_with_array) : alignof(T);
+    static constexpr size_t elements_offset =
+        (sizeof(control_block_with_array) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+    [[nodiscard]] auto elements() noexcept -> std::remove_cv_t<T>*
+    {
+        auto* address = reinterpret_cast<std::byte*>(this) + elements_offset;  // NOLINT
+        return std::launder(reinterpret_cast<std::remove_cv_t<T>*>(address));  // NOLINT
+    }
+
+    void destroy_data() noexcept
+    {
+        std::destroy_n(this->elements(), this->size);
+    }
+
+    void deallocate() noexcept
+    {
+        std::destroy_at(this);
+        ::operator delete(this, std::align_val_t {alignment});
+    }
+
+    [[nodiscard]] auto get_data() noexcept -> void*
+    {
+        return this->elements();
+    }
+};
+
+// size elements, value-initialized or copied from value
+template<typename Base, typename T, typename... Value>
+auto new_control_block_with_array(size_t size, const Value&... value)
+{
+    using control_block_type = control_block_with_array<Base, T>;
+
+    auto* memory = ::operator new(control_block_type::elements_offset + size * sizeof(T),
+                                  std::align_val_t {control_block_type::alignment});
+    auto* block = ::new (memory) control_block_type(size);
+    try {
+        // the elements constructed before the throwing one are already destroyed again
+        if constexpr (sizeof...(Value) == 0) {
+            std::uninitialized_value_construct_n(block->elements(), size);
+        } else {
+            std::uninitialized_fill_n(block->elements(), size, value...);
+        }
+    } catch (...) {
+        std::destroy_at(block);
+        ::operator delete(memory, std::align_val_t {control_block_type::alignment});
+        throw;
+    }
+    return block;
+}
+
+template<typename Base, typename T, typename Alloc>
+struct control_block_with_allocator final : Base
+{
+    using allocator_type = typename std::allocator_traits<Alloc>::template rebind_alloc<control_block_with_allocator>;
+    using allocator_traits = std::allocator_traits<allocator_type>;
+
+    // in a union so the value can be destroyed before the control block
+    union
+    {
+        T val;
+    };
+    // takes no space for stateless allocators
+    [[no_unique_address]] allocator_type alloc;
+
+    template<typename... Args>
+    explicit control_block_with_allocator(const allocator_type& i_alloc, Args&&... args)
+        : alloc {i_alloc}
+    {
+        this->manage = &Base::template manager_of<control_block_with_allocator>;
+        allocator_traits::construct(this->alloc, this->value_address(), std::forward<Args>(args)...);
+    }
+
+    control_block_with_allocator(const control_block_with_allocator&) = delete;
+    control_block_with_allocator(control_block_with_allocator&&) = delete;
+    auto operator=(const control_block_with_allocator&) -> control_block_with_allocator& = delete;
+    auto operator=(control_block_with_allocator&&) -> control_block_with_allocator& = delete;
+
+    ~control_block_with_allocator() noexcept {}  // NOLINT(modernize-use-equals-default)
+
+    void destroy_data() noexcept
+    {
+        allocator_traits::destroy(this->alloc, this->value_address());
+    }
+
+    [[nodiscard]] auto get_data() noexcept -> void*
+    {
+        return this->value_address();
+    }
+
+    void deallocate() noexcept
+    {
+        auto block_alloc = this->alloc;
+        std::destroy_at(this);
+        allocator_traits::deallocate(block_alloc, this, 1);
+    }
+
+    [[nodiscard]] auto value_address() noexcept -> std::remove_cv_t<T>*
+    {
+        return const_cast<std::remove_cv_t<T>*>(&this->val);  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    }
+};
+
+template<typename Base, typename T, typename Alloc, typename... Args>
+auto new_control_block_with_allocator(const Alloc& alloc, Args&&... args)
+{
+    using control_block_type = control_block_with_allocator<Base, T, Alloc>;
+
+    auto block_alloc = typename control_block_type::allocator_type(alloc);
+    auto* block = control_block_type::allocator_traits::allocate(block_alloc, 1);
+    try {
+        return std::construct_at(block, block_alloc, std::forward<Args>(args)...);
+    } catch (...) {
+        control_block_type::allocator_traits::deallocate(block_alloc, block, 1);
+        throw;
+    }
+}
+
+// The blocks made by one make_shared_n share an allocation, which is freed together with the last of them.
+struct control_block_batch
+{
+    std::atomic<size_t> blocks;
+};
+
+template<typename Base, typename T>
+struct control_block_in_batch final : Base
+{
+    control_block_batch* batch;
+    // in a union so the value can be destroyed before the control block
+    union
+    {
+        T val;
+    };
+
+    template<typename... Args>
+    explicit control_block_in_batch(control_block_batch* i_batch, const Args&... args) noexcept
+        : batch {i_batch}
+        , val {args...}
+    {
+        this->manage = &Base::template manager_of<control_block_in_batch>;
+    }
+
+    control_block_in_batch(const control_block_in_batch&) = delete;
+    control_block_in_batch(control_block_in_batch&&) = delete;
+    auto operator=(const control_block_in_batch&) -> control_block_in_batch& = delete;
+    auto operator=(control_block_in_batch&&) -> control_block_in_batch& = delete;
+
+    ~control_block_in_batch() noexcept {}  // NOLINT(modernize-use-equals-default)
+
+    static constexpr size_t alignment = alignof(control_block_in_batch) > alignof(control_block_batch)
+        ? alignof(control_block_in_batch)
+        : alignof(control_block_batch);
+    static constexpr size_t blocks_offset =
+        (sizeof(control_block_batch) + alignof(control_block_in_batch) - 1) / alignof(control_block_in_batch)
+        * alignof(control_block_in_batch);
+
+    void destroy_data() noexcept
+    {
+        std::destroy_at(&this->val);
+    }
+
+    void deallocate() noexcept
+    {
+        auto* owner = this->batch;
+        std::destroy_at(this);
+        if (owner->blocks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::destroy_at(owner);
+            ::operator delete(owner, std::align_val_t {alignment});
+        }
+    }
+
+    [[nodiscard]] auto get_data() noexcept -> void*
+    {
+        return const_cast<std::remove_cv_t<T>*>(&this->val);  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    }
+};
+
+// count blocks next to each other, each with a value constructed from args
+template<typename Base, typename T, typename... Args>
+auto new_control_blocks_in_batch(size_t count, const Args&... args)
+{
+    using control_block_type = control_block_in_batch<Base, T>;
+
+    auto* memory = ::operator new(control_block_type::blocks_offset + count * sizeof(control_block_type),
+                                  std::align_val_t {control_block_type::alignment});
+    auto* batch = ::new (memory) control_block_batch {count};
+    auto* blocks = static_cast<std::byte*>(memory) + control_block_type::blocks_offset;
+    for (size_t i = 0; i < count; i++) {
+        ::new (blocks + i * sizeof(control_block_type)) control_block_type(batch, args...);
+    }
+    return std::launder(reinterpret_cast<control_block_type*>(blocks));  // NOLINT
+}
+
+// Sums up the copies taken or dropped of each object in a small open-addressing table, so the counters of an object
+// that appears several times in a range are updated once. Once half the slots are taken the collected sums are
+// applied and the table starts over, the rest is applied when the batch goes out of scope.
+template<typename Policy, void (*Apply)(typename Policy::control_block*, typename Policy::handle, size_t) noexcept>
+struct reference_batch
+{
+    static constexpr size_t slots = 32;
+
+    struct entry
+    {
+        typename Policy::control_block* control {nullptr};
+        typename Policy::handle handle {};
+        size_t count {0};
+    };
+
+    std::array<entry, slots> entries {};
+    size_t used {0};
+
+    reference_batch() = default;
+    reference_batch(const reference_batch&) = delete;
+    reference_batch(reference_batch&&) = delete;
+    auto operator=(const reference_batch&) -> reference_batch& = delete;
+    auto operator=(reference_batch&&) -> reference_batch& = delete;
+
+    ~reference_batch()
+    {
+        this->flush();
+    }
+
+    void add(typename Policy::control_block* control, typename Policy::handle handle) noexcept
+    {
+        // Fibonacci hashing, as the low bits of neighbouring control blocks tell little apart
+        constexpr auto multiplier = std::uint64_t {0x9E3779B97F4A7C15};
+        constexpr auto slot_bits = std::bit_width(slots - 1);
+        auto hash = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(control)) * multiplier;  // NOLINT
+        auto slot = static_cast<size_t>(hash >> (64 - slot_bits));
+        while (true) {
+            auto& current = this->entries[slot];  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            if (current.control == control) {
+                current.count++;
+                return;
+            }
+            if (current.control == nullptr) {
+                current = entry {control, handle, 1};
+                if (++this->used == slots / 2) {
+                    this->flush();
+                }
+                return;
+            }
+            slot = (slot + 1) % slots;
+        }
+    }
+
+  private:
+    void flush() noexcept
+    {
+        if (this->used == 0) {
+            return;
+        }
+        for (auto& current : this->entries) {
+            if (current.control != nullptr) {
+                Apply(current.control, current.handle, current.count);
+                current = entry {};
+            }
+        }
+        this->used = 0;
+    }
+};
+
+// counts every copy or release right away
+template<typename Policy, void (*Apply)(typename Policy::control_block*, typename Policy::handle) noexcept>
+struct immediate_batch
+{
+    void add(typename Policy::control_block* control, typename Policy::handle handle) noexcept
+    {
+        Apply(control, handle);
+    }
+};
+
+template<typename Policy>
+auto copy_batch_of()
+{
+    if constexpr (requires { typename Policy::copy_batch; }) {
+        return std::type_identity<typename Policy::copy_batch>();
+    } else if constexpr (requires { &Policy::add_references; }) {
+        return std::type_identity<reference_batch<Policy, &Policy::add_references>>();
+    } else {
+        return std::type_identity<immediate_batch<Policy, &Policy::add_reference>>();
+    }
+}
+
+template<typename Policy>
+auto release_batch_of()
+{
+    if constexpr (requires { typename Policy::release_batch; }) {
+        return std::type_identity<typename Policy::release_batch>();
+    } else if constexpr (requires { &Policy::release_references; }) {
+        return std::type_identity<reference_batch<Policy, &Policy::release_references>>();
+    } else {
+        return std::type_identity<immediate_batch<Policy, &Policy::release_reference>>();
+    }
+}
+
+// what copy_all and release_all count the copies in a range with
+template<typename Policy>
+using copy_batch_t = typename decltype(copy_batch_of<Policy>())::type;
+
+template<typename Policy>
+using release_batch_t = typename decltype(release_batch_of<Policy>())::type;
+
+template<typename T>
+struct is_basic_shared_ptr : std::false_type
+{
+};
+
+template<typename T, typename Policy>
+struct is_basic_shared_ptr<basic_shared_ptr<T, Policy>> : std::true_type
+{
+};
+
+template<typename Policy, typename T>
+auto shared_from_this_base(const basic_enable_shared_from_this<T, Policy>* base) noexcept
+    -> basic_enable_shared_from_this<T, Policy>*
+{
+    return const_cast<basic_enable_shared_from_this<T, Policy>*>(base);  // NOLINT
+}
+
+// the parts of a shared_ptr that atomic holders store and rebuild it from
+struct shared_ptr_access
+{
+    template<typename T, typename Policy>
+    [[nodiscard]] static auto element_of(const basic_shared_ptr<T, Policy>& ptr) noexcept ->
+        typename basic_shared_ptr<T, Policy>::element_type*
+    {
+        return ptr.ptr_;
+    }
+
+    template<typename T, typename Policy>
+    [[nodiscard]] static auto control_of(const basic_shared_ptr<T, Policy>& ptr) noexcept ->
+        typename Policy::control_block*
+    {
+        return ptr.control_block_;
+    }
+
+    template<typename T, typename Policy>
+    [[nodiscard]] static auto handle_of(const basic_shared_ptr<T, Policy>& ptr) noexcept -> typename Policy::handle
+    {
+        return ptr.handle_;
+    }
+
+    // adopts a reference that has already been counted
+    template<typename T, typename Policy>
+    [[nodiscard]] static auto adopt(typename basic_shared_ptr<T, Policy>::element_type* ptr,
+                                    typename Policy::control_block* control) noexcept -> basic_shared_ptr<T, Policy>
+    {
+        return basic_shared_ptr<T, Policy>(ptr, control);
+    }
+
+    // a copy of ptr that does not count itself, the caller counts it
+    template<typename T, typename Policy>
+    [[nodiscard]] static auto uncounted_copy(const basic_shared_ptr<T, Policy>& ptr) noexcept
+        -> basic_shared_ptr<T, Policy>
+    {
+        return basic_shared_ptr<T, Policy>(ptr.ptr_, ptr.control_block_, ptr.handle_);
+    }
+
+    // makes empty dst a copy of src without counting it
+    template<typename T, typename Policy>
+    static void assign_uncounted(basic_shared_ptr<T, Policy>& dst, const basic_shared_ptr<T, Policy>& src) noexcept
+    {
+        dst.ptr_ = src.ptr_;
+        dst.control_block_ = src.control_block_;
+        dst.handle_ = src.handle_;
+    }
+
+    // empties ptr without releasing its reference, which the caller took over
+    template<typename T, typename Policy>
+    static void disown(basic_shared_ptr<T, Policy>& ptr) noexcept
+    {
+        ptr.ptr_ = nullptr;
+        ptr.control_block_ = nullptr;
+    }
+};
+
+}  // namespace detail
+
+template<typename T, typename Policy>
+struct basic_shared_ptr
+{
+    using element_type = typename std::remove_extent_t<T>;
+    using counter_type = size_t;
+    using policy_type = Policy;
+
+  private:
+    using control_block = typename Policy::control_block;
+    using handle = typename Policy::handle;
+
+    template<typename U, typename P>
+    friend struct basic_shared_ptr;
+    template<typename U, typename P>
+    friend struct basic_borrowed_ptr;
+    template<typename U, typename P>
+    friend struct basic_weak_ptr;
+    friend struct detail::shared_ptr_access;
+
+    element_type* ptr_ {nullptr};
+    control_block* control_block_ {nullptr};
+    // cached, so copying does not need to load anything from the control block
+    [[no_unique_address]] handle handle_ {};
+
+    // adopts a reference that has already been counted
+    basic_shared_ptr(element_type* ptr, control_block* control) noexcept
+        : ptr_(ptr)
+        , control_block_(control)
+        , handle_(Policy::handle_of(control))
+    {
+    }
+
+    basic_shared_ptr(element_type* ptr, control_block* control, handle cached_handle) noexcept
+        : ptr_(ptr)
+        , control_block_(control)
+        , handle_(cached_handle)
+    {
+    }
+
+  public:
+    basic_shared_ptr() = default;
+
+    explicit basic_shared_ptr(element_type* ptr)
+        : ptr_(ptr)
+        , control_block_(detail::new_control_block_with_deleter<control_block>(ptr, std::default_delete<T>()))
+        , handle_(Policy::handle_of(control_block_))
+    {
+        this->link_shared_from_this();
+    }
+
+    template<typename DeleterF>
+    basic_shared_ptr(element_type* ptr, DeleterF&& deleter)
+        : ptr_(ptr)
+        , control_block_(detail::new_control_block_with_deleter<control_block>(ptr, std::forward<DeleterF>(deleter)))
+        , handle_(Policy::handle_of(control_block_))
+    {
+        this->link_shared_from_this();
+    }
+
+    explicit basic_shared_ptr(detail::control_block_with_data<control_block, element_type>* control)
+        : ptr_(&control->val)
+        , control_block_(control)
+        , handle_(Policy::handle_of(control))
+    {
+        this->link_shared_from_this();
+    }
+
+    explicit basic_shared_ptr(detail::control_block_with_array<control_block, element_type>* control)
+        : ptr_(control->elements())
+        , control_block_(control)
+        , handle_(Policy::handle_of(control))
+    {
+    }
+
+    template<typename Alloc>
+    explicit basic_shared_ptr(detail::control_block_with_allocator<control_block, element_type, Alloc>* control)
+        : ptr_(&control->val)
+        , control_block_(control)
+        , handle_(Policy::handle_of(control))
+    {
+        this->link_shared_from_this();
+    }
+
+    explicit basic_shared_ptr(detail::control_block_in_batch<control_block, element_type>* control)
+        : ptr_(&control->val)
+        , control_block_(control)
+        , handle_(Policy::handle_of(control))
+    {
+        this->link_shared_from_this();
+    }
+
+    // aliasing constructors, shares ownership with other but points to ptr
+    template<typename U>
+    basic_shared_ptr(const basic_shared_ptr<U, Policy>& other, element_type* ptr) noexcept
+        : ptr_(ptr)
+        , control_block_(other.control_block_)
+        , handle_(other.handle_)
+    {
+        this->inc();
+    }
+
+    template<typename U>
+    basic_shared_ptr(basic_shared_ptr<U, Policy>&& other, element_type* ptr) noexcept
+        : ptr_(ptr)
+        , control_block_(other.control_block_)
+        , handle_(other.handle_)
+    {
+        other.ptr_ = nullptr;
+        other.control_block_ = nullptr;
+    }
+
+    template<typename U>
+        requires std::is_convertible_v<typename basic_shared_ptr<U, Policy>::element_type*, element_type*>
+    basic_shared_ptr(const basic_shared_ptr<U, Policy>& other) noexcept  // NOLINT(google-explicit-constructor)
+        : basic_shared_ptr(other, other.ptr_)
+    {
+    }
+
+    template<typename U>
+        requires std::is_convertible_v<typename basic_shared_ptr<U, Policy>::element_type*, element_type*>
+    basic_shared_ptr(basic_shared_ptr<U, Policy>&& other) noexcept  // NOLINT(google-explicit-constructor)
+        : basic_shared_ptr(std::move(other), other.ptr_)
+    {
+    }
+
+    basic_shared_ptr(const basic_shared_ptr& other) noexcept
+        : ptr_(other.ptr_)
+        , control_block_(other.control_block_)
+        , handle_(other.handle_)
+    {
+        this->inc();
+    }
+
+    // takes a new reference to the object of a borrowed_ptr
+    template<typename U>
+        requires std::is_convertible_v<typename basic_borrowed_ptr<U, Policy>::element_type*, element_type*>
+    explicit basic_shared_ptr(const basic_borrowed_ptr<U, Policy>& borrowed) noexcept
+        : ptr_(borrowed.ptr_)
+        , control_block_(borrowed.control_block_)
+    {
+        if (this->control_block_ != nullptr) {
+            this->handle_ = Policy::handle_of(this->control_block_);
+        }
+        this->inc();
+    }
+
+    basic_shared_ptr(basic_shared_ptr&& other) noexcept
+        : ptr_(other.ptr_)
+        , control_block_(other.control_block_)
+        , handle_(other.handle_)
+    {
+        other.ptr_ = nullptr;
+        other.control_block_ = nullptr;
+    }
+
+    auto operator=(const basic_shared_ptr& other) noexcept -> basic_shared_ptr&
+    {
+        if (this == &other) {
+            return *this;
+        }
+
+        if (this->control_block_ != other.control_block_) {
+            this->decrement_and_maybe_delete();
+            this->control_block_ = other.control_block_;
+            this->handle_ = other.handle_;
+            this->inc();
+        }
+        this->ptr_ = other.ptr_;
+        return *this;
+    }
+
+    auto operator=(basic_shared_ptr&& other) noexcept -> basic_shared_ptr&
+    {
+        if (this == &other) {
+            return *this;
+        }
+
+        if (this->control_block_ != other.control_block_) {
+            this->decrement_and_maybe_delete();
+            this->control_block_ = other.control_block_;
+            this->handle_ = other.handle_;
+        } else {
+            other.decrement_and_maybe_delete();
+        }
+
+        this->ptr_ = other.ptr_;
+        other.ptr_ = nullptr;
+        other.control_block_ = nullptr;
+        return *this;
+    }
+
+    ~basic_shared_ptr() noexcept
+    {
+        this->decrement_and_maybe_delete();
+    }
+
+    [[nodiscard]] auto get() noexcept -> element_type*
+    {
+        return this->ptr_;
+    }
+
+    [[nodiscard]] auto get() const noexcept -> const element_type*
+    {
+        return this->ptr_;
+    }
+
+    [[nodiscard]] auto operator*() const -> const element_type&
+    {
+        return *this->ptr_;
+    }
+
+    [[nodiscard]] auto operator*() -> element_type&
+    {
+        return *this->ptr_;
+    }
+
+    [[nodiscard]] auto operator->() const noexcept -> const element_type*
+    {
+        return this->ptr_;
+    }
+
+    [[nodiscard]] auto operator->() noexcept -> element_type*
+    {
+        return this->ptr_;
+    }
+
+    [[nodiscard]] auto operator[](std::ptrdiff_t index) const -> const element_type&
+        requires std::is_array_v<T>
+    {
+        return this->ptr_[index];
+    }
+
+    [[nodiscard]] auto operator[](std::ptrdiff_t index) -> element_type&
+        requires std::is_array_v<T>
+    {
+        return this->ptr_[index];
+    }
+
+    [[nodiscard]] auto use_count() const noexcept -> counter_type
+    {
+        if (this->control_block_ == nullptr) {
+            return 0;
+        }
+        return Policy::use_count(this->control_block_);
+    }
+
+    [[nodiscard]] auto unique() const noexcept -> bool
+    {
+        return this->control_block_ != nullptr && Policy::unique(this->control_block_, this->handle_);
+    }
+
+    void swap(basic_shared_ptr& other) noexcept
+    {
+        std::swap(this->ptr_, other.ptr_);
+        std::swap(this->control_block_, other.control_block_);
+        std::swap(this->handle_, other.handle_);
+    }
+
+    [[nodiscard]] explicit operator bool() const
+    {
+        return this->ptr_ != nullptr;
+    }
+
+  private:
+    // points an enable_shared_from_this base of a newly owned object at this control block
+    void link_shared_from_this() noexcept
+    {
+        if constexpr (!std::is_array_v<T> && requires { detail::shared_from_this_base<Policy>(this->ptr_); }) {
+            if (this->ptr_ != nullptr) {
+                auto* object = const_cast<std::remove_cv_t<element_type>*>(this->ptr_);  // NOLINT
+                detail::shared_from_this_base<Policy>(object)->link_owner(object, this->control_block_);
+            }
+        }
+    }
+
+    void inc() noexcept
+    {
+        if (this->control_block_ != nullptr) {
+            Policy::add_reference(this->control_block_, this->handle_);
+        }
+    }
+
+    void decrement_and_maybe_delete() noexcept
+    {
+        if (this->control_block_ != nullptr) {
+            Policy::release_reference(this->control_block_, this->handle_);
+        }
+    }
+};
+
+// Non-owning view of a shared_ptr, for passing objects down call chains without touching reference counts. The
+// shared_ptr it was made from has to outlive it, to_shared takes an owning copy when one is needed.
+template<typename T, typename Policy>
+struct basic_borrowed_ptr
+{
+    using element_type = typename std::remove_extent_t<T>;
+
+  private:
+    template<typename U, typename P>
+    friend struct basic_shared_ptr;
+    template<typename U, typename P>
+    friend struct basic_borrowed_ptr;
+
+    element_type* ptr_ {nullptr};
+    typename Policy::control_block* control_block_ {nullptr};
+
+  public:
+    basic_borrowed_ptr() = default;
+
+    template<typename U>
+        requires std::is_convertible_v<typename basic_shared_ptr<U, Policy>::element_type*, element_type*>
+    basic_borrowed_ptr(const basic_shared_ptr<U, Policy>& shared) noexcept  // NOLINT(google-explicit-constructor)
+        : ptr_(shared.ptr_)
+        , control_block_(shared.control_block_)
+    {
+    }
+
+    template<typename U>
+        requires std::is_convertible_v<typename basic_borrowed_ptr<U, Policy>::element_type*, element_type*>
+    basic_borrowed_ptr(const basic_borrowed_ptr<U, Policy>& other) noexcept  // NOLINT(google-explicit-constructor)
+        : ptr_(other.ptr_)
+        , control_block_(other.control_block_)
+    {
+    }
+
+    [[nodiscard]] auto get() noexcept -> element_type*
+    {
+        return this->ptr_;
+    }
+
+    [[nodiscard]] auto get() const noexcept -> const element_type*
+    {
+        return this->ptr_;
+    }
+
+    [[nodiscard]] auto operator*() const -> const element_type&
+    {
+        return *this->ptr_;
+    }
+
+    [[nodiscard]] auto operator*() -> element_type&
+    {
+        return *this->ptr_;
+    }
+
+    [[nodiscard]] auto operator->() const noexcept -> const element_type*
+    {
+        return this->ptr_;
+    }
+
+    [[nodiscard]] auto operator->() noexcept -> element_type*
+    {
+        return this->ptr_;
+    }
+
+    [[nodiscard]] auto operator[](std::ptrdiff_t index) const -> const element_type&
+        requires std::is_array_v<T>
+    {
+        return this->ptr_[index];
+    }
+
+    [[nodiscard]] auto operator[](std::ptrdiff_t index) -> element_type&
+        requires std::is_array_v<T>
+    {
+        return this->ptr_[index];
+    }
+
+    [[nodiscard]] explicit operator bool() const
+    {
+        return this->ptr_ != nullptr;
+    }
+
+    [[nodiscard]] auto to_shared() const noexcept -> basic_shared_ptr<T, Policy>
+    {
+        return basic_shared_ptr<T, Policy>(*this);
+    }
+};
+
+template<typename T, typename Policy>
+struct basic_weak_ptr
+{
+    using element_type = typename std::remove_extent_t<T>;
+    using counter_type = size_t;
+
+  private:
+    using control_block = typename Policy::control_block;
+
+    template<typename U, typename P>
+    friend struct basic_weak_ptr;
+    template<typename U, typename P>
+    friend struct basic_enable_shared_from_this;
+
+    element_type* ptr_ {nullptr};
+    control_block* control_block_ {nullptr};
+
+    // a new weak reference to the object of control
+    basic_weak_ptr(element_type* ptr, control_block* control) noexcept
+        : ptr_(ptr)
+        , control_block_(control)
+    {
+        this->inc_weak();
+    }
+
+  public:
+    basic_weak_ptr() = default;
+
+    template<typename U>
+        requires std::is_convertible_v<typename basic_shared_ptr<U, Policy>::element_type*, element_type*>
+    basic_weak_ptr(const basic_shared_ptr<U, Policy>& other) noexcept  // NOLINT(google-explicit-constructor)
+        : ptr_(detail::shared_ptr_access::element_of(other))
+        , control_block_(detail::shared_ptr_access::control_of(other))
+    {
+        this->inc_weak();
+    }
+
+    basic_weak_ptr(const basic_weak_ptr& other) noexcept
+        : ptr_(other.ptr_)
+        , control_block_(other.control_block_)
+    {
+        this->inc_weak();
+    }
+
+    basic_weak_ptr(basic_weak_ptr&& other) noexcept
+        : ptr_(other.ptr_)
+        , control_block_(other.control_block_)
+    {
+        other.ptr_ = nullptr;
+        other.control_block_ = nullptr;
+    }
+
+    auto operator=(const basic_weak_ptr& other) noexcept -> basic_weak_ptr&
+    {
+        if (this == &other) {
+            return *this;
+        }
+
+        this->decrement_weak_and_maybe_delete();
+        this->ptr_ = other.ptr_;
+        this->control_block_ = other.control_block_;
+        this->inc_weak();
+        return *this;
+    }
+
+    auto operator=(basic_weak_ptr&& other) noexcept -> basic_weak_ptr&
+    {
+        if (this == &other) {
+            return *this;
+        }
+
+        this->decrement_weak_and_maybe_delete();
+        this->ptr_ = other.ptr_;
+        this->control_block_ = other.control_block_;
+        other.ptr_ = nullptr;
+        other.control_block_ = nullptr;
+        return *this;
+    }
+
+    ~basic_weak_ptr() noexcept
+    {
+        this->decrement_weak_and_maybe_delete();
+    }
+
+    [[nodiscard]] auto lock() const noexcept -> basic_shared_ptr<T, Policy>
+    {
+        if (this->control_block_ == nullptr || !Policy::try_add_reference(this->control_block_)) {
+            return basic_shared_ptr<T, Policy>();
+        }
+        return detail::shared_ptr_access::adopt<T, Policy>(this->ptr_, this->control_block_);
+    }
+
+    [[nodiscard]] auto expired() const noexcept -> bool
+    {
+        return this->control_block_ == nullptr || Policy::expired(this->control_block_);
+    }
+
+    [[nodiscard]] auto use_count() const noexcept -> counter_type
+    {
+        if (this->control_block_ == nullptr) {
+            return 0;
+        }
+        return Policy::use_count(this->control_block_);
+    }
+
+    void reset() noexcept
+    {
+        this->decrement_weak_and_maybe_delete();
+        this->ptr_ = nullptr;
+        this->control_block_ = nullptr;
+    }
+
+    void swap(basic_weak_ptr& other) noexcept
+    {
+        std::swap(this->ptr_, other.ptr_);
+        std::swap(this->control_block_, other.control_block_);
+    }
+
+  private:
+    void inc_weak() noexcept
+    {
+        if (this->control_block_ != nullptr) {
+            this->control_block_->inc_weak();
+        }
+    }
+
+    void decrement_weak_and_maybe_delete() noexcept
+    {
+        if (this->control_block_ != nullptr) {
+            if (this->control_block_->decrement_weak_and_check_zero()) {
+                this->control_block_->deallocate();
+            }
+        }
+    }
+};
+
+// Lets an object owned by a shared_ptr hand out further shared_ptrs to itself. The first shared_ptr taking ownership of
+// the object, either through make_shared or from a raw pointer, points it at its control block.
+template<typename T, typename Policy>
+struct basic_enable_shared_from_this
+{
+  protected:
+    basic_enable_shared_from_this() noexcept = default;
+
+    // a copy is a different object, which is not owned by the same shared_ptrs
+    basic_enable_shared_from_this(const basic_enable_shared_from_this& /*other*/) noexcept {}
+
+    auto operator=(const basic_enable_shared_from_this& /*other*/) noexcept -> basic_enable_shared_from_this&
+    {
+        return *this;
+    }
+
+    ~basic_enable_shared_from_this() noexcept = default;
+
+  public:
+    // throws std::bad_weak_ptr if the object is not owned by a shared_ptr
+    [[nodiscard]] auto shared_from_this() -> basic_shared_ptr<T, Policy>
+    {
+        return this->lock_this();
+    }
+
+    [[nodiscard]] auto shared_from_this() const -> basic_shared_ptr<const T, Policy>
+    {
+        return this->lock_this();
+    }
+
+    [[nodiscard]] auto weak_from_this() noexcept -> basic_weak_ptr<T, Policy>
+    {
+        return this->weak_this_;
+    }
+
+  private:
+    template<typename U, typename P>
+    friend struct basic_shared_ptr;
+
+    mutable basic_weak_ptr<T, Policy> weak_this_;
+
+    [[nodiscard]] auto lock_this() const -> basic_shared_ptr<T, Policy>
+    {
+        auto locked = this->weak_this_.lock();
+        if (!locked) {
+            throw std::bad_weak_ptr();
+        }
+        return locked;
+    }
+
+    // objects that are already owned keep their first owner
+    void link_owner(T* object, typename Policy::control_block* control) const noexcept
+    {
+        if (this->weak_this_.expired()) {
+            this->weak_this_ = basic_weak_ptr<T, Policy>(object, control);
+        }
+    }
+};
+
+// like make_shared, but allocates the control block and the object together through alloc
+template<typename T, typename Policy, typename Alloc, typename... Args>
+    requires(!std::is_array_v<T>)
+auto basic_allocate_shared(const Alloc& alloc, Args&&... args) -> basic_shared_ptr<T, Policy>
+{
+    return basic_shared_ptr<T, Policy>(detail::new_control_block_with_allocator<typename Policy::control_block, T>(
+        alloc, std::forward<Args>(args)...));
+}
+
+// with WIND_SHARED_PTR_SLAB_ALLOCATOR defined, the control blocks come from the per-thread slab pools
+template<typename T, typename Policy, typename... Args>
+    requires(!std::is_array_v<T>)
+auto basic_make_shared(Args&&... args) -> basic_shared_ptr<T, Policy>
+{
+    return basic_shared_ptr<T, Policy>(
+        detail::new_control_block_with_data<typename Policy::control_block, T>(std::forward<Args>(args)...));
+}
+
+// size elements allocated together with the control block, value-initialized or copied from value
+template<typename T, typename Policy, typename... Value>
+    requires std::is_unbounded_array_v<T> && (sizeof...(Value) <= 1)
+auto basic_make_shared(size_t size, const Value&... value) -> basic_shared_ptr<T, Policy>
+{
+    return basic_shared_ptr<T, Policy>(
+        detail::new_control_block_with_array<typename Policy::control_block, std::remove_extent_t<T>>(size, value...));
+}
+
+template<typename T, typename Policy, typename... Value>
+    requires std::is_bounded_array_v<T> && (sizeof...(Value) <= 1)
+auto basic_make_shared(const Value&... value) -> basic_shared_ptr<T, Policy>
+{
+    return basic_shared_ptr<T, Policy>(
+        detail::new_control_block_with_array<typename Policy::control_block, std::remove_extent_t<T>>(
+            std::extent_v<T>, value...));
+}
+
+// count objects constructed from args, each with its own control block, which all share one allocation
+template<typename T, typename Policy, typename... Args>
+    requires(!std::is_array_v<T>)
+auto basic_make_shared_n(size_t count, const Args&... args) -> std::vector<basic_shared_ptr<T, Policy>>
+{
+    auto ptrs = std::vector<basic_shared_ptr<T, Policy>>();
+    if (count == 0) {
+        return ptrs;
+    }
+    ptrs.reserve(count);
+    auto* blocks = detail::new_control_blocks_in_batch<typename Policy::control_block, T>(count, args...);
+    for (size_t i = 0; i < count; i++) {
+        ptrs.emplace_back(blocks + i);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+    return ptrs;
+}
+
+namespace detail
+{
+// The factories of one policy as function objects, which a policy's namespace names in a variable template each:
+//
+//     template<typename T>
+//     inline constexpr wind::detail::make_shared_function<T, counting_policy> make_shared {};
+template<typename T, typename Policy>
+struct make_shared_function
+{
+    template<typename... Args>
+        requires(!std::is_array_v<T>)
+    auto operator()(Args&&... args) const -> basic_shared_ptr<T, Policy>
+    {
+        return basic_make_shared<T, Policy>(std::forward<Args>(args)...);
+    }
+
+    // size value-initialized elements, allocated together with the control block
+    auto operator()(size_t size) const -> basic_shared_ptr<T, Policy>
+        requires std::is_unbounded_array_v<T>
+    {
+        return basic_make_shared<T, Policy>(size);
+    }
+
+    auto operator()(size_t size, const std::remove_extent_t<T>& value) const -> basic_shared_ptr<T, Policy>
+        requires std::is_unbounded_array_v<T>
+    {
+        return basic_make_shared<T, Policy>(size, value);
+    }
+
+    auto operator()() const -> basic_shared_ptr<T, Policy>
+        requires std::is_bounded_array_v<T>
+    {
+        return basic_make_shared<T, Policy>();
+    }
+
+    auto operator()(const std::remove_extent_t<T>& value) const -> basic_shared_ptr<T, Policy>
+        requires std::is_bounded_array_v<T>
+    {
+        return basic_make_shared<T, Policy>(value);
+    }
+};
+
+template<typename T, typename Policy>
+    requires(!std::is_array_v<T>)
+struct make_shared_n_function
+{
+    template<typename... Args>
+    auto operator()(size_t count, const Args&... args) const -> std::vector<basic_shared_ptr<T, Policy>>
+    {
+        return basic_make_shared_n<T, Policy>(count, args...);
+    }
+};
+
+template<typename T, typename Policy>
+    requires(!std::is_array_v<T>)
+struct allocate_shared_function
+{
+    template<typename Alloc, typename... Args>
+    auto operator()(const Alloc& alloc, Args&&... args) const -> basic_shared_ptr<T, Policy>
+    {
+        return basic_allocate_shared<T, Policy>(alloc, std::forward<Args>(args)...);
+    }
+};
+
+}  // namespace detail
+
+// copies every shared_ptr of ptrs, with the counting batched as the policy allows
+template<std::ranges::input_range Range>
+    requires detail::is_basic_shared_ptr<std::ranges::range_value_t<Range>>::value
+auto copy_all(Range&& ptrs) -> std::vector<std::ranges::range_value_t<Range>>
+{
+    using shared_ptr_type = std::ranges::range_value_t<Range>;
+    using policy = typename shared_ptr_type::policy_type;
+    using access = detail::shared_ptr_access;
+
+    auto copies = std::vector<shared_ptr_type>();
+    auto batch = detail::copy_batch_t<policy>();
+    auto count = [&batch](const shared_ptr_type& ptr)
+    {
+        if (auto* control = access::control_of(ptr); control != nullptr) {
+            batch.add(control, access::handle_of(ptr));
+        }
+    };
+    if constexpr (std::ranges::sized_range<Range>) {
+        // filled in place, which saves push_back its capacity checks
+        copies.resize(std::ranges::size(ptrs));
+        auto copy = copies.begin();
+        for (const auto& ptr : ptrs) {
+            access::assign_uncounted(*copy++, ptr);
+            count(ptr);
+        }
+    } else {
+        for (const auto& ptr : ptrs) {
+            copies.push_back(access::uncounted_copy(ptr));
+            count(ptr);
+        }
+    }
+    return copies;
+}
+
+// empties every shared_ptr of ptrs, with the releases batched as the policy allows
+template<std::ranges::input_range Range>
+    requires detail::is_basic_shared_ptr<std::ranges::range_value_t<Range>>::value
+void release_all(Range& ptrs) noexcept
+{
+    using shared_ptr_type = std::ranges::range_value_t<Range>;
+    using policy = typename shared_ptr_type::policy_type;
+    using access = detail::shared_ptr_access;
+
+    auto batch = detail::release_batch_t<policy>();
+    for (auto& ptr : ptrs) {
+        if (auto* control = access::control_of(ptr); control != nullptr) {
+            batch.add(control, access::handle_of(ptr));
+            access::disown(ptr);
+        }
+    }
+}
+
+}  // namespace wind
@@ -0,0 +1,378 @@
+#pragma once
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#include <shared_ptr/bias_shared_ptr.hpp>
+#include <shared_ptr/epoch.hpp>
+
+namespace wind::bias
+{
+template<typename T>
+struct atomic_shared_ptr;
+
+// The value of an atomic_shared_ptr read without taking a reference. It stays valid while the epoch::guard it was read
+// under is active.
+template<typename T>
+struct snapshot
+{
+    using element_type = typename shared_ptr<T>::element_type;
+
+    snapshot() noexcept = default;
+
+    [[nodiscard]] auto get() const noexcept -> element_type*
+    {
+        return this->ptr_;
+    }
+
+    [[nodiscard]] auto operator*() const noexcept -> element_type&
+    {
+        return *this->ptr_;
+    }
+
+    [[nodiscard]] auto operator->() const noexcept -> element_type*
+    {
+        return this->ptr_;
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept
+    {
+        return this->ptr_ != nullptr;
+    }
+
+    // a shared_ptr to the object, which may outlive the guard
+    [[nodiscard]] auto share() const noexcept -> shared_ptr<T>
+    {
+        return atomic_shared_ptr<T>::share(this->ptr_, this->control_block_);
+    }
+
+  private:
+    friend struct atomic_shared_ptr<T>;
+
+    snapshot(element_type* ptr, detail::control_block* control_block) noexcept
+        : ptr_(ptr)
+        , control_block_(control_block)
+    {
+    }
+
+    element_type* ptr_ {nullptr};
+    detail::control_block* control_block_ {nullptr};
+};
+
+// Lock-free atomic holder of a bias::shared_ptr using split reference counting.
+//
+// The stored control block pointer shares a 64 bit word with an external count in the upper 16 bits. The held value
+// owns one global reference. A load first increments the external count, which borrows a reference that keeps the
+// control block alive, then takes a real global reference and gives the borrowed one back by decrementing the
+// external count again. A store pins the value it replaces the same way and converts the external count it finds into
+// global references before swapping it out, so loaders that lost the race drop the reference converted for them.
+//
+// Pointers that do not point to the object owned by their control block (aliased or converted pointers) are stored
+// indirectly, in a control block holding the shared_ptr itself, and marked by the lowest bit of the word.
+//
+// Replaced values are retired through epoch::retire rather than released, so snapshots read under an epoch::guard
+// without touching any counter stay valid until the guard is left.
+template<typename T>
+struct atomic_shared_ptr
+{
+    using value_type = shared_ptr<T>;
+    using element_type = typename value_type::element_type;
+
+    static constexpr bool is_always_lock_free = std::atomic<std::uintptr_t>::is_always_lock_free;
+
+  private:
+    friend struct snapshot<T>;
+
+    using word_t = std::uintptr_t;
+    using access = wind::detail::shared_ptr_access;
+
+    static_assert(sizeof(word_t) == 8, "atomic_shared_ptr packs a count into the unused bits of 64 bit pointers");
+
+    static constexpr int count_shift = 48;
+    static constexpr word_t count_one = word_t {1} << count_shift;
+    static constexpr word_t indirect_flag = 1;
+    static constexpr word_t pointer_mask = count_one - 1 - indirect_flag;
+
+    mutable std::atomic<word_t> word_ {0};
+
+    [[nodiscard]] static auto control_of(word_t word) noexcept -> detail::control_block*
+    {
+        return reinterpret_cast<detail::control_block*>(word & pointer_mask);  // NOLINT
+    }
+
+    [[nodiscard]] static auto count_of(word_t word) noexcept -> size_t
+    {
+        return static_cast<size_t>(word >> count_shift);
+    }
+
+    // the element pointer of a stored word, the control block must be kept alive by the caller
+    [[nodiscard]] static auto element_of(word_t word) noexcept -> element_type*
+    {
+        auto* data = control_of(word)->get_data();
+        if ((word & indirect_flag) != 0) {
+            return access::element_of(*static_cast<value_type*>(data));
+        }
+        return static_cast<element_type*>(data);
+    }
+
+    // turns desired into a word that owns one global reference
+    [[nodiscard]] static auto to_word(value_type desired) noexcept -> word_t
+    {
+        auto* control = access::control_of(desired);
+        if (control == nullptr) {
+            return 0;
+        }
+
+        if (static_cast<element_type*>(control->get_data()) != access::element_of(desired)) {
+            // the holder starts out as one copy held by this thread, which becomes the stored reference
+            auto* holder =
+                wind::detail::new_control_block_with_data<detail::control_block, value_type>(std::move(desired));
+            detail::return_local_counter(holder, holder->key);
+            return to_bits(holder) | indirect_flag;
+        }
+
+        detail::surrender_local_reference(control);
+        access::disown(desired);
+        return to_bits(control);
+    }
+
+    [[nodiscard]] static auto to_bits(detail::control_block* control) noexcept -> word_t
+    {
+        auto bits = reinterpret_cast<word_t>(control);  // NOLINT
+        assert((bits & ~pointer_mask) == 0);
+        return bits;
+    }
+
+    // drops the global reference owned by a word
+    static void release(word_t word) noexcept
+    {
+        if (auto* control = control_of(word); control != nullptr) {
+            detail::release_global_references(control, 1);
+        }
+    }
+
+    // drops the global reference owned by a replaced word, once no snapshot of it can be in use anymore
+    static void retire(word_t word) noexcept
+    {
+        if (auto* control = control_of(word); control != nullptr) {
+            epoch::retire(control,
+                          [](void* retired) noexcept
+                          { detail::release_global_references(static_cast<detail::control_block*>(retired), 1); });
+        }
+    }
+
+    // a new copy on the calling thread, the control block must be kept alive by the caller
+    [[nodiscard]] static auto share(element_type* element, detail::control_block* control) noexcept -> value_type
+    {
+        if (control == nullptr) {
+            return value_type();
+        }
+
+        detail::add_local_reference(control, control->key);
+        return access::adopt<T, counting_policy>(element, control);
+    }
+
+    // borrows a reference through the external count, which keeps the stored control block alive until unpin
+    [[nodiscard]] auto pin() const noexcept -> word_t
+    {
+        return this->word_.fetch_add(count_one, std::memory_order_acq_rel) + count_one;
+    }
+
+    // gives a borrowed reference back, or drops the global reference it was converted into if the value was swapped out
+    void unpin(word_t pinned) const noexcept
+    {
+        auto* control = control_of(pinned);
+        if (control == nullptr) {
+            return;
+        }
+
+        auto current = pinned;
+        while (control_of(current) == control && count_of(current) != 0) {
+            if (this->word_.compare_exchange_weak(current, current - count_one, std::memory_order_acq_rel)) {
+                return;
+            }
+        }
+
+        // The count can only reach zero with the same control block if the value was swapped out and stored again, in
+        // which case a pinner of the earlier value gave back our borrowed reference and kept the one converted for it.
+        detail::release_global_references(control, 1);
+    }
+
+    // whether the stored word holds expected, the control block must be kept alive by the caller
+    [[nodiscard]] static auto matches(word_t word, const value_type& expected) noexcept -> bool
+    {
+        auto* control = control_of(word);
+        auto* expected_control = access::control_of(expected);
+        if (control == nullptr || expected_control == nullptr) {
+            return control == expected_control;
+        }
+        if (element_of(word) != access::element_of(expected)) {
+            return false;
+        }
+        // an indirectly stored pointer is expected either as loaded, sharing the holder, or as it was stored
+        return control == expected_control
+            || ((word & indirect_flag) != 0
+                && access::control_of(*static_cast<value_type*>(control->get_data())) == expected_control);
+    }
+
+    // Replaces the stored word by desired, if expected is null or matches the stored value, and returns the replaced
+    // word, which still owns its global reference. The references borrowed through it are converted into global ones
+    // before the swap becomes visible, so pinners that lost the race can drop theirs right away. On a mismatch expected
+    // becomes a copy of the value it was compared with.
+    [[nodiscard]] auto swap_word(word_t desired, value_type* expected) noexcept -> std::optional<word_t>
+    {
+        auto current = this->word_.load(std::memory_order_acquire);
+        while (true) {
+            if (control_of(current) == nullptr) {
+                if (expected != nullptr && access::control_of(*expected) != nullptr) {
+                    *expected = value_type();
+                    return std::nullopt;
+                }
+                if (this->word_.compare_exchange_weak(current, desired, std::memory_order_acq_rel)) {
+                    return word_t {0};
+                }
+                continue;
+            }
+
+            auto pinned = this->pin();
+            auto* control = control_of(pinned);
+            if (control == nullptr) {
+                current = pinned;
+                continue;
+            }
+            if (expected != nullptr && !matches(pinned, *expected)) {
+                *expected = share(element_of(pinned), control);
+                this->unpin(pinned);
+                return std::nullopt;
+            }
+
+            current = pinned;
+            while (control_of(current) == control && count_of(current) != 0) {
+                auto others = count_of(current) - 1;
+                if (others != 0) {
+                    control->global_counter.fetch_add(others);
+                }
+                if (this->word_.compare_exchange_weak(current, desired, std::memory_order_acq_rel)) {
+                    return current & (count_one - 1);
+                }
+                // the stored value, or the one converted for our borrowed reference, keeps this above zero
+                if (others != 0) {
+                    control->global_counter.fetch_sub(others);
+                }
+            }
+
+            // swapped out by someone else, who converted our borrowed reference
+            detail::release_global_references(control, 1);
+        }
+    }
+
+  public:
+    atomic_shared_ptr() noexcept = default;
+
+    explicit atomic_shared_ptr(value_type desired) noexcept
+        : word_(to_word(std::move(desired)))
+    {
+    }
+
+    atomic_shared_ptr(const atomic_shared_ptr&) = delete;
+    atomic_shared_ptr(atomic_shared_ptr&&) = delete;
+    auto operator=(const atomic_shared_ptr&) -> atomic_shared_ptr& = delete;
+    auto operator=(atomic_shared_ptr&&) -> atomic_shared_ptr& = delete;
+
+    ~atomic_shared_ptr() noexcept
+    {
+        retire(this->word_.load(std::memory_order_acquire));
+    }
+
+    auto operator=(value_type desired) noexcept -> atomic_shared_ptr&
+    {
+        this->store(std::move(desired));
+        return *this;
+    }
+
+    [[nodiscard]] explicit operator value_type() const noexcept
+    {
+        return this->load();
+    }
+
+    [[nodiscard]] auto is_lock_free() const noexcept -> bool
+    {
+        return this->word_.is_lock_free();
+    }
+
+    [[nodiscard]] auto load() const noexcept -> value_type
+    {
+        if (control_of(this->word_.load(std::memory_order_acquire)) == nullptr) {
+            return value_type();
+        }
+
+        auto pinned = this->pin();
+        auto* control = control_of(pinned);
+        if (control == nullptr) {
+            return value_type();
+        }
+
+        auto loaded = share(element_of(pinned), control);
+        this->unpin(pinned);
+        return loaded;
+    }
+
+    // the stored value without taking a reference, valid while the guard is active
+    [[nodiscard]] auto load(const epoch::guard& /*guard*/) const noexcept -> snapshot<T>
+    {
+        auto word = this->word_.load();
+        if (control_of(word) == nullptr) {
+            return snapshot<T>();
+        }
+        return snapshot<T>(element_of(word), control_of(word));
+    }
+
+    void store(value_type desired) noexcept
+    {
+        retire(*this->swap_word(to_word(std::move(desired)), nullptr));
+    }
+
+    auto exchange(value_type desired) noexcept -> value_type
+    {
+        auto replaced = *this->swap_word(to_word(std::move(desired)), nullptr);
+        if (control_of(replaced) == nullptr) {
+            return value_type();
+        }
+        auto previous = share(element_of(replaced), control_of(replaced));
+        retire(replaced);
+        return previous;
+    }
+
+    // on failure expected becomes a copy of the stored value it was compared with
+    auto compare_exchange_strong(value_type& expected, value_type desired) noexcept -> bool
+    {
+        {
+            // keeps the stored control block from being released while it is compared and shared
+            auto guard = epoch::guard();
+            auto word = this->word_.load(std::memory_order_acquire);
+            if (!matches(word, expected)) {
+                expected = share(element_of(word), control_of(word));
+                return false;
+            }
+        }
+
+        auto desired_word = to_word(std::move(desired));
+        if (auto replaced = this->swap_word(desired_word, &expected)) {
+            retire(*replaced);
+            return true;
+        }
+        release(desired_word);
+        return false;
+    }
+
+    // The strong exchange only retries while the stored value still matches, so it never fails spuriously and costs
+    // no more than a single attempt would. The weak one is the same.
+    auto compare_exchange_weak(value_type& expected, value_type desired) noexcept -> bool
+    {
+        return this->compare_exchange_strong(expected, std::move(desired));
+    }
+};
+
+}  // namespace wind::bias
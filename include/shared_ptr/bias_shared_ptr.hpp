@@ -1,35 +1,269 @@
 #pragma once
+#include <array>
 #include <atomic>
-#include <cassert>
-#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
 
+#include <shared_ptr/basic_shared_ptr.hpp>
 #include <shared_ptr/thread_local_storage.hpp>
 
 namespace wind::bias
 {
 namespace detail
 {
-template<typename T>
-struct control_block
+#if defined(WIND_SHARED_PTR_BIAS_STATISTICS)
+inline constexpr bool keep_statistics = true;
+#else
+inline constexpr bool keep_statistics = false;
+#endif
+
+// what the hot path counts when statistics are kept, see bias::statistics
+enum class event : size_t
 {
-    T* data;
-    std::atomic<size_t> global_counter {1};
+    local_hit,
+    local_miss,
+    global_increment,
+    global_decrement,
+    key_created,
+    key_returned,
+    control_block_destroyed,
+    count
+};
+
+// One thread's counters. Only that thread writes them, so counting is a relaxed load and store.
+using thread_statistics = std::array<std::atomic<size_t>, static_cast<size_t>(event::count)>;
+
+// the counters of the running threads, and the counts of those that exited
+struct statistics_registry
+{
+    std::mutex mutex;
+    std::vector<thread_statistics*> threads;
+    // written by every exiting thread, so counted with fetch_add
+    thread_statistics exited {};
+};
+
+inline auto all_statistics() -> statistics_registry&
+{
+    static statistics_registry registry;
+    return registry;
+}
+
+// plain values, so they can still be read in destructors that run while the thread exits
+inline thread_local thread_statistics* this_thread_statistics = nullptr;
+inline thread_local bool this_thread_exited = false;
+
+// Registers the counters of a thread while it runs. At exit they are folded into the exited counts, and later events
+// of the thread are counted there directly.
+struct thread_statistics_owner
+{
+    thread_statistics counters {};
+
+    thread_statistics_owner()
+    {
+        auto& registry = all_statistics();
+        auto lock = std::lock_guard(registry.mutex);
+        registry.threads.push_back(&this->counters);
+        this_thread_statistics = &this->counters;
+    }
+
+    thread_statistics_owner(const thread_statistics_owner&) = delete;
+    thread_statistics_owner(thread_statistics_owner&&) = delete;
+    auto operator=(const thread_statistics_owner&) -> thread_statistics_owner& = delete;
+    auto operator=(thread_statistics_owner&&) -> thread_statistics_owner& = delete;
+
+    ~thread_statistics_owner()
+    {
+        auto& registry = all_statistics();
+        auto lock = std::lock_guard(registry.mutex);
+        for (size_t i = 0; i < this->counters.size(); i++) {
+            registry.exited[i].fetch_add(this->counters[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        std::erase(registry.threads, &this->counters);
+        this_thread_statistics = nullptr;
+        this_thread_exited = true;
+    }
+};
+
+inline void record([[maybe_unused]] event counted) noexcept
+{
+    if constexpr (keep_statistics) {
+        auto index = static_cast<size_t>(counted);
+        if (this_thread_statistics == nullptr) {
+            if (this_thread_exited) {
+                all_statistics().exited[index].fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            thread_local thread_statistics_owner owner;
+        }
+        auto& counter = (*this_thread_statistics)[index];
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+}
+
+struct control_block;
+
+// a thread's number of copies of one control block
+struct local_count
+{
+    size_t count {0};
+    control_block* control {nullptr};
+};
+
+// hands the copies an exiting thread still counts over to the global counter
+struct release_on_thread_exit
+{
+    static void on_thread_exit(local_count& local) noexcept;
+};
+
+using local_count_storage = thread_local_storage<local_count, release_on_thread_exit>;
+
+// A thread's queue of the control blocks it created whose copies other threads released without counting them.
+// Records are never freed, so control blocks can keep naming creators that have exited, and stay linked in a
+// process-wide list.
+struct release_queue
+{
+    std::atomic<control_block*> head {nullptr};
+    release_queue* next_queue {nullptr};
+};
+
+inline auto new_release_queue() -> release_queue*
+{
+    static std::atomic<release_queue*> queues {nullptr};
+
+    auto* queue = new release_queue();  // NOLINT(cppcoreguidelines-owning-memory)
+    queue->next_queue = queues.load(std::memory_order_relaxed);
+    while (!queues.compare_exchange_weak(queue->next_queue, queue, std::memory_order_release)) {
+    }
+    return queue;
+}
+
+// the calling thread's queue, nullptr until it created a control block and again after it exited
+inline thread_local release_queue* this_thread_queue = nullptr;
+
+// values of control_block::next_queued and release_queue::head that name no control block
+enum class queue_mark : size_t
+{
+    claimed,
+    end,
+    closed,
+};
+
+inline auto marked(queue_mark mark) noexcept -> control_block*
+{
+    static std::array<char, 3> marks {};
+    return reinterpret_cast<control_block*>(&marks[static_cast<size_t>(mark)]);  // NOLINT
+}
+
+// tag for control blocks whose first copy is not counted on the creating thread
+struct uncounted_t
+{
+};
+
+inline constexpr uncounted_t uncounted {};
+
+struct control_block : wind::detail::managed_control_block<control_block>
+{
+    static constexpr size_t stray_one = size_t {1} << 32;
+    static constexpr size_t holder_mask = stray_one - 1;
+    static constexpr std::uintptr_t creator_counts = 1;
 
-    explicit control_block(T* i_data) noexcept
-        : data {i_data}
+    // Threads holding copies in the lower 32 bits. The upper 32 bits count, as a signed number, the copies left behind
+    // by exited threads or handed back by the creator, minus the copies released on threads that did not count them.
+    // The object is alive while the whole word is non-zero.
+    std::atomic<size_t> global_counter {1};
+    // number of weak_ptrs and creator queue entries, plus one while global_counter is non-zero
+    std::atomic<size_t> weak_counter {1};
+    // process-wide key of the per-thread local counters
+    local_count_storage::key_t key;
+    // The release queue of the creating thread, with creator_counts set while that thread holds a local counter. Only
+    // the creator writes it.
+    std::atomic<std::uintptr_t> creator;
+    // the next control block in the creator's release queue, nullptr while not queued
+    std::atomic<control_block*> next_queued {nullptr};
+
+    // the creating thread starts out holding one copy
+    control_block() noexcept;
+    // the first copy is a stray one, which no thread counts
+    explicit control_block(uncounted_t /*tag*/) noexcept;
+
+    control_block(const control_block& other) noexcept = delete;
+    control_block(control_block&& other) noexcept = delete;
+    auto operator=(const control_block& other) noexcept -> control_block& = delete;
+    auto operator=(control_block&& other) noexcept -> control_block& = delete;
+
+    ~control_block() noexcept
     {
+        // only a block whose value failed to construct still has the creator counting it
+        if (auto* queue = this->counting_creator(); queue != nullptr && queue == this_thread_queue) {
+            local_count_storage::return_key(this->key);
+        }
+        local_count_storage::destroy_key(this->key);
+        record(event::control_block_destroyed);
     }
 
-    control_block(const control_block& other) noexcept = default;
-    control_block(control_block&& other) noexcept = default;
-    auto operator=(const control_block& other) noexcept -> control_block& = default;
-    auto operator=(control_block&& other) noexcept -> control_block& = default;
+    // the creator's release queue if the creator may count copies, otherwise nullptr
+    [[nodiscard]] auto counting_creator() const noexcept -> release_queue*
+    {
+        auto bits = this->creator.load(std::memory_order_relaxed);
+        if ((bits & creator_counts) == 0) {
+            return nullptr;
+        }
+        return reinterpret_cast<release_queue*>(bits & ~creator_counts);  // NOLINT
+    }
 
-    virtual ~control_block() noexcept = default;
+    // records whether the calling thread holds a local counter, if it is the creator
+    void note_local_counter(bool held) noexcept
+    {
+        auto bits = this->creator.load(std::memory_order_relaxed);
+        auto* queue = this_thread_queue;
+        if (queue != nullptr && (bits & ~creator_counts) == reinterpret_cast<std::uintptr_t>(queue)) {  // NOLINT
+            this->creator.store(reinterpret_cast<std::uintptr_t>(queue) | (held ? creator_counts : 0),  // NOLINT
+                                std::memory_order_relaxed);
+        }
+    }
 
     void inc_global()
     {
         this->global_counter++;
+        record(event::global_increment);
+    }
+
+    // increments the global counter unless it already reached zero
+    [[nodiscard]] auto try_inc_global() noexcept -> bool
+    {
+        auto count = this->global_counter.load();
+        while (count != 0) {
+            if (this->global_counter.compare_exchange_weak(count, count + 1)) {
+                record(event::global_increment);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void inc_weak() noexcept
+    {
+        this->weak_counter++;
+    }
+
+    [[nodiscard]] auto decrement_weak_and_check_zero() noexcept -> bool
+    {
+        return --this->weak_counter == 0;
+    }
+
+    void release_weak() noexcept
+    {
+        if (this->decrement_weak_and_check_zero()) {
+            this->deallocate();
+        }
+    }
+
+    void release_data() noexcept
+    {
+        this->destroy_data();
+        this->release_weak();
     }
 
     void inc(size_t& counter) noexcept
@@ -40,252 +274,521 @@ struct control_block
     [[nodiscard]] auto decrement_and_check_zero(size_t& counter) noexcept -> bool
     {
         if (--counter == 0) {
+            record(event::global_decrement);
             return --this->global_counter == 0;
         }
         return false;
     }
 };
 
-template<typename T>
-struct control_block_with_data : control_block<T>
+// gives a thread's local counter of a control block back to the storage
+inline void return_local_counter(control_block* control, local_count_storage::key_t key) noexcept
 {
-    T val;
+    local_count_storage::return_key(key);
+    control->note_local_counter(false);
+    record(event::key_returned);
+}
 
-    template<typename... Args>
-    explicit control_block_with_data(Args&&... args) noexcept
-        : control_block<T>(&this->val)
-        , val {std::forward<Args>(args)...}
-    {
+// drops count global references, and destroys the object if they were the last ones
+inline void release_global_references(control_block* control, size_t count) noexcept
+{
+    if (count == 0) {
+        return;
     }
-    control_block_with_data(const control_block_with_data& other) noexcept = default;
-    control_block_with_data(control_block_with_data&& other) noexcept = default;
-    auto operator=(const control_block_with_data& other) noexcept -> control_block_with_data& = default;
-    auto operator=(control_block_with_data&& other) noexcept -> control_block_with_data& = default;
-    ~control_block_with_data() noexcept override = default;
-};
+    record(event::global_decrement);
+    if (control->global_counter.fetch_sub(count) == count) {
+        control->release_data();
+    }
+}
 
-template<typename T, typename DeleterF>
-struct control_block_with_deleter final : control_block<T>
+// Adds delta, which takes one stray copy off the global counter, and queues the control block on its creator. The copy
+// may have been counted there, in which case only the creator handing back its local count lets the word reach zero.
+inline void apply_stray_copy(control_block* control, size_t delta) noexcept
 {
-    DeleterF deleter;
-
-    control_block_with_deleter(T* i_data, DeleterF i_deleter) noexcept
-        : control_block<T>(i_data)
-        , deleter {std::move(i_deleter)}
-    {
+    auto* queue = control->counting_creator();
+    auto* not_queued = static_cast<control_block*>(nullptr);
+    auto queues = queue != nullptr
+        && control->next_queued.compare_exchange_strong(not_queued, marked(queue_mark::claimed), std::memory_order_relaxed);
+    if (queues) {
+        // the queue entry keeps the control block allocated until the creator took it off
+        control->inc_weak();
     }
 
-    control_block_with_deleter(const control_block_with_deleter&) noexcept = default;
-    control_block_with_deleter(control_block_with_deleter&&) noexcept = default;
-    auto operator=(const control_block_with_deleter&) noexcept -> control_block_with_deleter& = default;
-    auto operator=(control_block_with_deleter&&) noexcept -> control_block_with_deleter& = default;
+    if (control->global_counter.fetch_add(delta) + delta == 0) {
+        control->release_data();
+        if (queues) {
+            control->release_weak();
+        }
+        return;
+    }
+    if (!queues) {
+        return;
+    }
 
-    ~control_block_with_deleter() noexcept override
-    {
-        this->deleter(this->data);
-    };
-};
+    auto* head = queue->head.load(std::memory_order_acquire);
+    do {
+        if (head == marked(queue_mark::closed)) {
+            // the creator exited, and its local counter went to the global counter then
+            control->release_weak();
+            return;
+        }
+        control->next_queued.store(head == nullptr ? marked(queue_mark::end) : head, std::memory_order_relaxed);
+    } while (!queue->head.compare_exchange_weak(head, control, std::memory_order_acq_rel, std::memory_order_acquire));
+}
 
-template<typename T, typename DeleterF>
-auto new_control_block_with_deleter(T* ptr, DeleterF&& deleter)
+// releases a copy that the calling thread does not count, because it was copied on another thread
+inline void release_stray_copy(control_block* control) noexcept
 {
-    return new control_block_with_deleter<T, DeleterF>(ptr, std::forward<DeleterF>(deleter));  // NOLINT
+    record(event::global_decrement);
+    apply_stray_copy(control, size_t {0} - control_block::stray_one);
 }
 
-template<typename T, typename... Args>
-auto new_control_block_with_data(Args&&... args)
+// turns a copy held by the calling thread into one global reference owned by the caller
+inline void surrender_local_reference(control_block* control) noexcept
 {
-    return new control_block_with_data<T>(std::forward<Args>(args)...);  // NOLINT
+    auto* local_counter = local_count_storage::find(control->key);
+    if (local_counter == nullptr || local_counter->count == 0) {
+        // copied on another thread, which still counts it, so the stray copy it stands for becomes the global reference
+        record(event::local_miss);
+        record(event::global_increment);
+        apply_stray_copy(control, 1 - control_block::stray_one);
+        return;
+    }
+    record(event::local_hit);
+    if (--local_counter->count == 0) {
+        // the thread's own global reference is passed on
+        return_local_counter(control, control->key);
+        return;
+    }
+    control->inc_global();
 }
 
-}  // namespace detail
-
-template<typename T>
-struct shared_ptr
+inline void release_on_thread_exit::on_thread_exit(local_count& local) noexcept
 {
-    using counter_type = size_t;
-    using local_reference_counter_type = size_t;
-    using element_type = typename std::remove_extent_t<T>;
-    using local_count_storage = thread_local_storage<local_reference_counter_type>;
+    // the thread's own global reference goes, the copies it still counts now live elsewhere or were leaked
+    auto* control = local.control;
+    auto delta = local.count * control_block::stray_one - 1;
+    record(event::global_decrement);
+    if (control->global_counter.fetch_add(delta) + delta == 0) {
+        control->release_data();
+    }
+}
 
-  private:
-    detail::control_block<T>* control_block_ {nullptr};
-    local_count_storage::key_t key_ {};
+// Global decrements of the calling thread that have not been applied yet.
+//
+// With a batch size set, a thread dropping its last copy keeps its local counter at zero and queues the control block
+// instead of decrementing the global counter. The thread still holds its global reference, so taking a copy again
+// before the queue is flushed costs no atomic operation at all. The queue is flushed once it reaches the batch size,
+// on flush() and at thread exit, which delays the destruction of objects released by this thread until then.
+struct deferred_releases
+{
+    struct entry
+    {
+        control_block* control;
+        local_count_storage::key_t key;
+    };
 
-  public:
-    shared_ptr() = default;
+    std::vector<entry> pending;
+    size_t batch_size {0};
+    bool exiting {false};
 
-    explicit shared_ptr(detail::control_block_with_data<T>* control)
-        : control_block_(control)
-        , key_(local_count_storage::create_key(1))
+    deferred_releases()
     {
+        // the flush at thread exit needs the local counters and keys
+        local_count_storage::init_thread();
     }
 
-    explicit shared_ptr(T* data)
-        : control_block_(detail::new_control_block_with_deleter(data, std::default_delete<element_type>()))
-        , key_(local_count_storage::create_key(1))
-    {
-    }
+    deferred_releases(const deferred_releases&) = delete;
+    deferred_releases(deferred_releases&&) = delete;
+    auto operator=(const deferred_releases&) -> deferred_releases& = delete;
+    auto operator=(deferred_releases&&) -> deferred_releases& = delete;
 
-    // stuff
-    shared_ptr(const shared_ptr& other) noexcept
-        : control_block_(other.control_block_)
-        , key_(other.key_)
+    ~deferred_releases()
     {
-        this->initial_or_inc();
+        this->exiting = true;
+        while (!this->pending.empty()) {
+            this->flush();
+        }
     }
 
-    shared_ptr(shared_ptr&& other) noexcept
-        : control_block_(std::move(other.control_block_))
-        , key_(other.key_)
+    // drops the calling thread's last copy and queues the release of its global reference, returns false if the
+    // release has to happen right away instead
+    [[nodiscard]] auto defer(control_block* control, local_count& local_counter) -> bool
     {
-        other.control_block_ = nullptr;
+        if (this->batch_size == 0 || this->exiting) {
+            return false;
+        }
+        local_counter.count = 0;
+        this->pending.push_back(entry {control, control->key});
+        if (this->pending.size() >= this->batch_size) {
+            this->flush();
+        }
+        return true;
     }
 
-    auto operator=(const shared_ptr& other) noexcept -> shared_ptr&
+    void flush() noexcept
     {
-        if (this == &other) {
-            return *this;
+        // destroying an object can release and queue further references, which then go into the next batch
+        auto batch = std::vector<entry>();
+        batch.swap(this->pending);
+
+        // first give up the local counters still at zero, a control block queued twice only has its first entry
+        // applied. Nothing is released before all counters are checked, so the keys still name the same blocks.
+        auto applied = batch.begin();
+        for (auto& current : batch) {
+            auto* local_counter = local_count_storage::find(current.key);
+            if (local_counter != nullptr && local_counter->count == 0) {
+                return_local_counter(current.control, current.key);
+                *applied++ = current;
+            }
+        }
+        for (auto it = batch.begin(); it != applied; ++it) {
+            release_global_references(it->control, 1);
         }
 
-        if (this->control_block_ != other.control_block_) {
-            this->decrement_and_maybe_delete();
-            this->control_block_ = other.control_block_;
-            this->key_ = other.key_;
-            this->initial_or_inc();
+        if (this->pending.empty()) {
+            batch.clear();
+            this->pending.swap(batch);
         }
-        return *this;
     }
+};
 
-    auto operator=(shared_ptr&& other) noexcept -> shared_ptr&
-    {
-        if (this == &other) {
-            return *this;
-        }
+inline auto thread_releases() -> deferred_releases&
+{
+    thread_local deferred_releases releases;
+    return releases;
+}
 
-        if (this->control_block_ != other.control_block_) {
-            this->decrement_and_maybe_delete();
-            this->control_block_ = other.control_block_;
-            this->key_ = other.key_;
-        } else {
-            other.decrement_and_maybe_delete();
+// drops a copy counted in the calling thread's local counter, and the object if it was the last one
+inline void release_counted_copy(control_block* control, local_count& local_counter) noexcept
+{
+    if (local_counter.count == 1 && thread_releases().defer(control, local_counter)) {
+        return;
+    }
+    // another thread may free the block once the global counter drops, so nothing of it is read afterwards
+    auto key = control->key;
+    auto last = local_counter.count == 1;
+    if (last) {
+        control->note_local_counter(false);
+    }
+    auto delete_control_block = control->decrement_and_check_zero(local_counter.count);
+
+    if (last) {
+        local_count_storage::return_key(key);
+        record(event::key_returned);
+    }
+    if (delete_control_block) {
+        control->release_data();
+    }
+}
+
+// Hands the calling thread's local count of each queued control block over to the global counter. Its copies become
+// stray ones, so a copy it counted but another thread released no longer keeps the object alive.
+inline void hand_back_local_counts(control_block* queued) noexcept
+{
+    while (queued != marked(queue_mark::end)) {
+        auto* control = queued;
+        queued = control->next_queued.load(std::memory_order_relaxed);
+
+        if (auto* local_counter = local_count_storage::find(control->key);
+            local_counter != nullptr && local_counter->count != 0)
+        {
+            // the thread's global reference keeps the word above zero, and is dropped like its last copy
+            record(event::global_increment);
+            control->global_counter.fetch_add(local_counter->count * control_block::stray_one);
+            local_counter->count = 1;
+            release_counted_copy(control, *local_counter);
         }
+        control->next_queued.store(nullptr, std::memory_order_release);
+        control->release_weak();
+    }
+}
 
-        other.control_block_ = nullptr;
-        return *this;
+// hands back the local counts of the control blocks queued on the calling thread since it last did
+inline void hand_back_queued() noexcept
+{
+    auto* queue = this_thread_queue;
+    if (queue != nullptr && queue->head.load(std::memory_order_relaxed) != nullptr) {
+        hand_back_local_counts(queue->head.exchange(nullptr, std::memory_order_acquire));
     }
+}
 
-    ~shared_ptr() noexcept
+// registers the calling thread's release queue, and closes it when the thread exits
+struct release_queue_registration
+{
+    release_queue_registration()
     {
-        this->decrement_and_maybe_delete();
-        this->control_block_ = nullptr;
+        // handing back at exit needs the deferred releases and the local counters
+        static_cast<void>(thread_releases());
+        this_thread_queue = new_release_queue();
     }
 
-    [[nodiscard]] auto get() noexcept -> element_type*
+    release_queue_registration(const release_queue_registration&) = delete;
+    release_queue_registration(release_queue_registration&&) = delete;
+    auto operator=(const release_queue_registration&) -> release_queue_registration& = delete;
+    auto operator=(release_queue_registration&&) -> release_queue_registration& = delete;
+
+    ~release_queue_registration()
     {
-        if (this->control_block_ == nullptr) {
-            return nullptr;
+        auto* queue = this_thread_queue;
+        this_thread_queue = nullptr;
+        // anything queued later finds the queue closed, its local counters are handed over on exit anyway
+        if (auto* queued = queue->head.exchange(marked(queue_mark::closed), std::memory_order_acq_rel);
+            queued != nullptr)
+        {
+            hand_back_local_counts(queued);
         }
-        return this->control_block_->data;
     }
+};
 
-    [[nodiscard]] auto get() const noexcept -> const element_type*
-    {
-        if (this->control_block_ == nullptr) {
-            return nullptr;
-        }
-        return this->control_block_->data;
+inline auto this_thread_release_queue() -> release_queue*
+{
+    if (this_thread_queue == nullptr) {
+        thread_local release_queue_registration registration;
     }
+    return this_thread_queue;
+}
 
-    [[nodiscard]] auto operator*() const -> const element_type&
-    {
-        return *this->control_block_->data;
+inline control_block::control_block() noexcept
+    : key {local_count_storage::create_key(local_count {1, this})}
+    , creator {reinterpret_cast<std::uintptr_t>(this_thread_release_queue()) | creator_counts}  // NOLINT
+{
+    record(event::key_created);
+    hand_back_queued();
+}
+
+inline control_block::control_block(uncounted_t /*tag*/) noexcept
+    : global_counter {stray_one}
+    , key {local_count_storage::create_key()}
+    , creator {reinterpret_cast<std::uintptr_t>(this_thread_release_queue())}  // NOLINT
+{
+    record(event::key_created);
+    hand_back_queued();
+}
+
+// counts a new copy on the calling thread, key is the key of control
+inline void add_local_reference(control_block* control, local_count_storage::key_t key) noexcept
+{
+    auto [local_counter, already_existed] = local_count_storage::get_or_create(key, local_count {0, control});
+    control->inc(local_counter.get().count);
+    if (already_existed) {
+        record(event::local_hit);
+        return;
     }
+    record(event::local_miss);
+    control->inc_global();
+    control->note_local_counter(true);
+    hand_back_queued();
+}
 
-    [[nodiscard]] auto operator*() -> element_type&
-    {
-        return *this->control_block_->data;
+// releases a copy on the calling thread, and the object if it was the last one
+inline void release_local_reference(control_block* control, local_count_storage::key_t key) noexcept
+{
+    auto* local_counter = local_count_storage::find(key);
+    if (local_counter == nullptr || local_counter->count == 0) {
+        // copied on another thread, which still counts it
+        record(event::local_miss);
+        release_stray_copy(control);
+        return;
+    }
+    record(event::local_hit);
+    auto last = local_counter->count == 1;
+    release_counted_copy(control, *local_counter);
+    if (last) {
+        hand_back_queued();
     }
+}
 
-    [[nodiscard]] auto operator->() const noexcept -> const element_type*
+}  // namespace detail
+
+// Defers the global decrements of copies released by the calling thread and applies them in batches of batch_size.
+// Zero, the default, applies every decrement right away.
+inline void set_release_batch_size(size_t batch_size)
+{
+    auto& releases = detail::thread_releases();
+    releases.batch_size = batch_size;
+    releases.flush();
+}
+
+// applies the deferred global decrements of the calling thread and the copies other threads handed back to it
+inline void flush()
+{
+    detail::hand_back_queued();
+    detail::thread_releases().flush();
+}
+
+// Hot path counters of bias::shared_ptr, kept per thread when WIND_SHARED_PTR_BIAS_STATISTICS is defined and zero
+// otherwise, in which case counting compiles to nothing.
+struct statistics
+{
+    // copies and releases that found a local counter on the calling thread
+    size_t local_hits {0};
+    // copies and releases that did not, and so touched the global counter or created a local one
+    size_t local_misses {0};
+    size_t global_increments {0};
+    size_t global_decrements {0};
+    // keys made for new control blocks, and local counters given back when a thread dropped its last copy
+    size_t keys_created {0};
+    size_t keys_returned {0};
+    size_t control_blocks_destroyed {0};
+
+    // the counts since an earlier read
+    [[nodiscard]] auto operator-(const statistics& earlier) const noexcept -> statistics
     {
-        // TODO(wind) all these if statements for getting the element should be optimized by caching T* in the
-        // shared_ptr. also helps with double indirect
-        if (this->control_block_ == nullptr) {
-            return nullptr;
-        }
-        return this->control_block_->data;
+        return statistics {
+            this->local_hits - earlier.local_hits,
+            this->local_misses - earlier.local_misses,
+            this->global_increments - earlier.global_increments,
+            this->global_decrements - earlier.global_decrements,
+            this->keys_created - earlier.keys_created,
+            this->keys_returned - earlier.keys_returned,
+            this->control_blocks_destroyed - earlier.control_blocks_destroyed,
+        };
     }
+};
 
-    [[nodiscard]] auto operator->() noexcept -> element_type*
+// The counts of all threads so far, also of those that exited. Threads that are still running may have counted a bit
+// more than what is read.
+inline auto read_statistics() -> statistics
+{
+    auto totals = std::array<size_t, static_cast<size_t>(detail::event::count)> {};
+    auto& registry = detail::all_statistics();
     {
-        if (this->control_block_ == nullptr) {
-            return nullptr;
+        auto lock = std::lock_guard(registry.mutex);
+        for (size_t i = 0; i < totals.size(); i++) {
+            totals[i] = registry.exited[i].load(std::memory_order_relaxed);
+        }
+        for (const auto* counters : registry.threads) {
+            for (size_t i = 0; i < totals.size(); i++) {
+                totals[i] += (*counters)[i].load(std::memory_order_relaxed);
+            }
         }
-        return this->control_block_->data;
     }
 
-    [[nodiscard]] auto use_count() const -> const counter_type&
+    auto count = [&totals](detail::event counted) { return totals[static_cast<size_t>(counted)]; };
+    return statistics {
+        count(detail::event::local_hit),
+        count(detail::event::local_miss),
+        count(detail::event::global_increment),
+        count(detail::event::global_decrement),
+        count(detail::event::key_created),
+        count(detail::event::key_returned),
+        count(detail::event::control_block_destroyed),
+    };
+}
+
+// Per-thread local counters and a global counter of the threads holding copies. Copies and releases on a thread that
+// already holds copies touch only its local counter.
+struct counting_policy
+{
+    using control_block = detail::control_block;
+    // the key of the control block's local counters, cached so copies do not load it from the control block
+    using handle = detail::local_count_storage::key_t;
+
+    [[nodiscard]] static auto handle_of(control_block* control) noexcept -> handle
     {
-        return this->control_block_->counter;
+        return control->key;
     }
 
-    [[nodiscard]] auto unique() const -> size_t
+    static void add_reference(control_block* control, handle key) noexcept
     {
-        return this->control_block_->counter == 1;
+        detail::add_local_reference(control, key);
     }
 
-    void swap(shared_ptr other)
+    static void release_reference(control_block* control, handle key) noexcept
     {
-        std::swap(this->control_block_, other->control_block_);
-        std::swap(this->key_, other->key_);
+        detail::release_local_reference(control, key);
     }
 
-    [[nodiscard]] explicit operator bool() const
+    // Counts the copies in a range against the calling thread's local counters, which are looked up once for the
+    // whole range rather than once per copy.
+    struct copy_batch
     {
-        return this->control_block_ != nullptr;
-    }
+        detail::local_count_storage::thread_view local_counts {detail::local_count_storage::this_thread()};
+
+        void add(control_block* control, handle key) noexcept
+        {
+            if (auto* local_counter = this->local_counts.find(key); local_counter != nullptr) {
+                local_counter->count++;
+                detail::record(detail::event::local_hit);
+                return;
+            }
+            detail::add_local_reference(control, key);
+        }
+    };
+
+    struct release_batch
+    {
+        detail::local_count_storage::thread_view local_counts {detail::local_count_storage::this_thread()};
+
+        void add(control_block* control, handle key) noexcept
+        {
+            // dropping a copy that is not the thread's last one only touches the local counter
+            auto* local_counter = this->local_counts.find(key);
+            if (local_counter != nullptr && local_counter->count > 1) {
+                local_counter->count--;
+                detail::record(detail::event::local_hit);
+                return;
+            }
+            detail::release_local_reference(control, key);
+        }
+    };
 
-  private:
-    [[nodiscard]] auto get_local_counter(local_reference_counter_type initial_count = 1)
-        -> local_reference_counter_type&
+    [[nodiscard]] static auto try_add_reference(control_block* control) noexcept -> bool
     {
-        auto [local_counter_ref, already_existed] = local_count_storage::get_or_create(&this->key_, initial_count);
-        if (!already_existed) {
-            this->control_block_->inc_global();
+        // a thread that already holds copies keeps the object alive, so it only bumps its own counter
+        if (auto* local_counter = detail::local_count_storage::find(control->key); local_counter != nullptr) {
+            local_counter->count++;
+            detail::record(detail::event::local_hit);
+            return true;
         }
-        return local_counter_ref.get();
+
+        detail::record(detail::event::local_miss);
+        if (!control->try_inc_global()) {
+            return false;
+        }
+        detail::local_count_storage::get_or_create(control->key, detail::local_count {1, control});
+        control->note_local_counter(true);
+        return true;
     }
 
-    void initial_or_inc() noexcept
+    // number of threads holding copies, not the number of copies
+    [[nodiscard]] static auto use_count(const control_block* control) noexcept -> size_t
     {
-        if (this->control_block_ != nullptr) {
-            this->control_block_->inc(this->get_local_counter(0));
-        }
+        return control->global_counter.load(std::memory_order_relaxed) & control_block::holder_mask;
     }
 
-    void decrement_and_maybe_delete()
+    [[nodiscard]] static auto expired(const control_block* control) noexcept -> bool
     {
-        if (this->control_block_ != nullptr) {
-            auto& local_counter = this->get_local_counter();
-            auto delete_control_block = this->control_block_->decrement_and_check_zero(local_counter);
+        return control->global_counter.load() == 0;
+    }
 
-            if (local_counter == 0) {
-                local_count_storage::return_key(this->key_);
-            }
-            if (delete_control_block) {
-                delete this->control_block_;
-            }
-        }
+    [[nodiscard]] static auto unique(const control_block* control, handle key) noexcept -> bool
+    {
+        return control->global_counter.load() == 1 && detail::local_count_storage::contains(key)
+            && detail::local_count_storage::get(key).count == 1;
     }
 };
 
-template<typename T, typename... Args>
-auto make_shared(Args&&... args) -> shared_ptr<typename std::remove_extent_t<T>>
-{
-    using element_type = typename std::remove_extent_t<T>;
+template<typename T>
+using shared_ptr = basic_shared_ptr<T, counting_policy>;
 
-    return shared_ptr<element_type>(detail::new_control_block_with_data<element_type>(std::forward<Args>(args)...));
-}
+template<typename T>
+using weak_ptr = basic_weak_ptr<T, counting_policy>;
+
+template<typename T>
+using borrowed_ptr = basic_borrowed_ptr<T, counting_policy>;
+
+template<typename T>
+using enable_shared_from_this = basic_enable_shared_from_this<T, counting_policy>;
+
+template<typename T>
+inline constexpr wind::detail::make_shared_function<T, counting_policy> make_shared {};
+
+template<typename T>
+inline constexpr wind::detail::make_shared_n_function<T, counting_policy> make_shared_n {};
+
+template<typename T>
+inline constexpr wind::detail::allocate_shared_function<T, counting_policy> allocate_shared {};
 
 }  // namespace wind::bias
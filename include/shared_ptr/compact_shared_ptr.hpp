@@ -0,0 +1,145 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+
+#include <shared_ptr/basic_shared_ptr.hpp>
+
+namespace wind::compact
+{
+namespace detail
+{
+// more references than a 32 bit counter holds cannot be counted, and wrapping around would free a live object
+[[noreturn]] inline void count_overflow() noexcept
+{
+    std::terminate();
+}
+
+// Like local::detail::control_block, but with 32 bit counters packed next to the manager, so the block takes 16 bytes
+// instead of 24 and a make_shared<int64_t> allocation 24 instead of 32.
+struct control_block : wind::detail::managed_control_block<control_block>
+{
+    static constexpr uint32_t max_count = std::numeric_limits<uint32_t>::max();
+
+    uint32_t counter {1};
+    // number of weak_ptrs, plus one while counter is non-zero
+    uint32_t weak_counter {1};
+
+    control_block() noexcept = default;
+    control_block(const control_block&) = delete;
+    control_block(control_block&&) = delete;
+    auto operator=(const control_block&) -> control_block& = delete;
+    auto operator=(control_block&&) -> control_block& = delete;
+    ~control_block() noexcept = default;
+
+    void inc() noexcept
+    {
+        if (this->counter == max_count) {
+            count_overflow();
+        }
+        this->counter++;
+    }
+
+    void inc_weak() noexcept
+    {
+        if (this->weak_counter == max_count) {
+            count_overflow();
+        }
+        this->weak_counter++;
+    }
+
+    [[nodiscard]] auto decrement_and_check_zero() noexcept -> bool
+    {
+        return --this->counter == 0;
+    }
+
+    [[nodiscard]] auto decrement_weak_and_check_zero() noexcept -> bool
+    {
+        return --this->weak_counter == 0;
+    }
+
+    void release_data() noexcept
+    {
+        this->destroy_data();
+        if (this->decrement_weak_and_check_zero()) {
+            this->deallocate();
+        }
+    }
+};
+
+}  // namespace detail
+
+// a plain 32 bit counter, not thread safe
+struct counting_policy
+{
+    using control_block = detail::control_block;
+
+    struct handle
+    {
+    };
+
+    [[nodiscard]] static auto handle_of(control_block* /*control*/) noexcept -> handle
+    {
+        return {};
+    }
+
+    static void add_reference(control_block* control, handle /*handle*/) noexcept
+    {
+        control->inc();
+    }
+
+    static void release_reference(control_block* control, handle /*handle*/) noexcept
+    {
+        if (control->decrement_and_check_zero()) {
+            control->release_data();
+        }
+    }
+
+    [[nodiscard]] static auto try_add_reference(control_block* control) noexcept -> bool
+    {
+        if (control->counter == 0) {
+            return false;
+        }
+        control->inc();
+        return true;
+    }
+
+    [[nodiscard]] static auto use_count(const control_block* control) noexcept -> size_t
+    {
+        return control->counter;
+    }
+
+    [[nodiscard]] static auto expired(const control_block* control) noexcept -> bool
+    {
+        return control->counter == 0;
+    }
+
+    [[nodiscard]] static auto unique(const control_block* control, handle /*handle*/) noexcept -> bool
+    {
+        return control->counter == 1;
+    }
+};
+
+template<typename T>
+using shared_ptr = basic_shared_ptr<T, counting_policy>;
+
+template<typename T>
+using weak_ptr = basic_weak_ptr<T, counting_policy>;
+
+template<typename T>
+using borrowed_ptr = basic_borrowed_ptr<T, counting_policy>;
+
+template<typename T>
+using enable_shared_from_this = basic_enable_shared_from_this<T, counting_policy>;
+
+template<typename T>
+inline constexpr wind::detail::make_shared_function<T, counting_policy> make_shared {};
+
+template<typename T>
+inline constexpr wind::detail::make_shared_n_function<T, counting_policy> make_shared_n {};
+
+template<typename T>
+inline constexpr wind::detail::allocate_shared_function<T, counting_policy> allocate_shared {};
+
+}  // namespace wind::compact
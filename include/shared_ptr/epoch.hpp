@@ -0,0 +1,193 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace wind::epoch
+{
+// Epoch based reclamation.
+//
+// Readers enter a guard, which announces the global epoch they started in, and may then read shared objects without
+// counting references. Writers unlink an object and retire it, tagged with the epoch it was retired in. The global
+// epoch only advances once every active reader announced the current one, so an object is released once the epoch
+// moved two steps past its tag. If no guard is active at all, retired objects are released right away.
+namespace detail
+{
+struct retired_object
+{
+    std::uint64_t epoch;
+    void* object;
+    void (*release)(void*) noexcept;
+};
+
+// A thread's announced epoch, zero outside guards, and the objects it retired. Records are never freed, the record of
+// an exited thread is taken over by the next thread, together with the objects it could not release yet.
+struct thread_record
+{
+    std::atomic<std::uint64_t> announced {0};
+    std::atomic<bool> in_use {true};
+    thread_record* next {nullptr};
+    std::size_t depth {0};
+    std::vector<retired_object> limbo;
+};
+
+inline constexpr std::size_t retire_batch_size = 64;
+
+inline std::atomic<std::uint64_t> global_epoch {1};
+inline std::atomic<thread_record*> records {nullptr};
+
+inline auto acquire_record() -> thread_record*
+{
+    for (auto* record = records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+        auto in_use = false;
+        if (!record->in_use.load(std::memory_order_relaxed)
+            && record->in_use.compare_exchange_strong(in_use, true, std::memory_order_acquire))
+        {
+            return record;
+        }
+    }
+
+    auto* record = new thread_record();  // NOLINT(cppcoreguidelines-owning-memory), linked into records for good
+    record->next = records.load(std::memory_order_relaxed);
+    while (!records.compare_exchange_weak(
+        record->next, record, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+    return record;
+}
+
+// holds the calling thread's record and gives it back on thread exit
+struct registration
+{
+    thread_record* record {acquire_record()};
+
+    registration() = default;
+    registration(const registration&) = delete;
+    registration(registration&&) = delete;
+    auto operator=(const registration&) -> registration& = delete;
+    auto operator=(registration&&) -> registration& = delete;
+
+    ~registration()
+    {
+        this->record->in_use.store(false, std::memory_order_release);
+    }
+};
+
+inline auto this_thread() -> thread_record&
+{
+    thread_local registration current;
+    return *current.record;
+}
+
+[[nodiscard]] inline auto any_active() noexcept -> bool
+{
+    for (auto* record = records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+        if (record->announced.load() != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// advances the global epoch if every active thread announced the current one, and returns the global epoch
+inline auto try_advance() noexcept -> std::uint64_t
+{
+    auto epoch = global_epoch.load();
+    for (auto* record = records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+        if (auto announced = record->announced.load(); announced != 0 && announced != epoch) {
+            return epoch;
+        }
+    }
+    if (global_epoch.compare_exchange_strong(epoch, epoch + 1)) {
+        return epoch + 1;
+    }
+    return epoch;
+}
+
+// releases the objects of a record that no active guard can see anymore, or all of them if no guard is active
+inline void collect(thread_record& record, bool everything) noexcept
+{
+    auto epoch = try_advance();
+    auto& limbo = record.limbo;
+    auto due = std::partition(limbo.begin(),
+                              limbo.end(),
+                              [everything, epoch](const retired_object& retired)
+                              { return !everything && retired.epoch + 2 > epoch; });
+    // releasing may retire further objects, so the due ones are taken out first
+    auto released = std::vector<retired_object>(due, limbo.end());
+    limbo.erase(due, limbo.end());
+    for (auto& retired : released) {
+        retired.release(retired.object);
+    }
+}
+
+}  // namespace detail
+
+// Marks the calling thread as reading shared objects, which are not released until the guard is left. Guards nest and
+// must be left on the thread that entered them.
+struct guard
+{
+    guard() noexcept
+        : record_(&detail::this_thread())
+    {
+        if (this->record_->depth++ == 0) {
+            this->record_->announced.store(detail::global_epoch.load(std::memory_order_relaxed));
+        }
+    }
+
+    guard(const guard&) = delete;
+    guard(guard&&) = delete;
+    auto operator=(const guard&) -> guard& = delete;
+    auto operator=(guard&&) -> guard& = delete;
+
+    ~guard() noexcept
+    {
+        if (--this->record_->depth == 0) {
+            this->record_->announced.store(0, std::memory_order_release);
+        }
+    }
+
+  private:
+    detail::thread_record* record_;
+};
+
+// Calls release(object) once no guard that may still see the object is active. The object must already be unreachable
+// for readers entering a guard from now on.
+inline void retire(void* object, void (*release)(void*) noexcept)
+{
+    auto& record = detail::this_thread();
+    // orders unlinking the object before looking for guards that may have seen it
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!detail::any_active()) {
+        release(object);
+        if (!record.limbo.empty()) {
+            detail::collect(record, true);
+        }
+        return;
+    }
+
+    record.limbo.push_back(detail::retired_object {detail::global_epoch.load(), object, release});
+    if (record.limbo.size() >= detail::retire_batch_size) {
+        detail::collect(record, false);
+    }
+}
+
+// Releases what the calling thread and exited threads retired, as far as active guards allow.
+inline void reclaim() noexcept
+{
+    auto everything = !detail::any_active();
+    detail::collect(detail::this_thread(), everything);
+    for (auto* record = detail::records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+        auto in_use = false;
+        if (!record->in_use.load(std::memory_order_relaxed)
+            && record->in_use.compare_exchange_strong(in_use, true, std::memory_order_acquire))
+        {
+            detail::collect(*record, everything);
+            record->in_use.store(false, std::memory_order_release);
+        }
+    }
+}
+
+}  // namespace wind::epoch
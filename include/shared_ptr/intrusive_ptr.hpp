@@ -0,0 +1,336 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <shared_ptr/bias_shared_ptr.hpp>
+
+namespace wind
+{
+// Intrusive reference counting. An object derives from one of the counted bases below, passing itself as T, and
+// carries its reference count itself, so it needs no separate control block. The bases count like the shared_ptr
+// implementations: local_counted like local::shared_ptr, bias_counted like bias::shared_ptr by embedding its control
+// block, and atomic_counted with a single atomic counter like std::shared_ptr.
+//
+// Objects start out with one reference, which make_intrusive hands to the first intrusive_ptr.
+template<typename T>
+struct intrusive_ptr;
+
+// tag for taking over the reference a new object starts out with
+struct adopt_reference_t
+{
+};
+
+inline constexpr adopt_reference_t adopt_reference {};
+
+// not thread safe, like local::shared_ptr
+template<typename T>
+struct local_counted
+{
+    using counting_base = local_counted;
+
+  protected:
+    local_counted() noexcept = default;
+
+    // a copy is a new object with its own count
+    local_counted(const local_counted& /*other*/) noexcept {}
+
+    auto operator=(const local_counted& /*other*/) noexcept -> local_counted&
+    {
+        return *this;
+    }
+
+    ~local_counted() noexcept = default;
+
+  private:
+    template<typename U>
+    friend struct intrusive_ptr;
+
+    size_t counter_ {1};
+
+    static void add_reference(local_counted* counted) noexcept
+    {
+        counted->counter_++;
+    }
+
+    static void release_reference(local_counted* counted) noexcept
+    {
+        // there are no weak references, so the object is destroyed together with its count
+        if (--counted->counter_ == 0) {
+            delete static_cast<T*>(counted);  // NOLINT(cppcoreguidelines-owning-memory)
+        }
+    }
+
+    [[nodiscard]] static auto reference_count(const local_counted* counted) noexcept -> size_t
+    {
+        return counted->counter_;
+    }
+};
+
+// one atomic counter shared by all threads, like std::shared_ptr
+template<typename T>
+struct atomic_counted
+{
+    using counting_base = atomic_counted;
+
+  protected:
+    atomic_counted() noexcept = default;
+
+    // a copy is a new object with its own count
+    atomic_counted(const atomic_counted& /*other*/) noexcept {}
+
+    auto operator=(const atomic_counted& /*other*/) noexcept -> atomic_counted&
+    {
+        return *this;
+    }
+
+    ~atomic_counted() noexcept = default;
+
+  private:
+    template<typename U>
+    friend struct intrusive_ptr;
+
+    std::atomic<size_t> counter_ {1};
+
+    static void add_reference(atomic_counted* counted) noexcept
+    {
+        counted->counter_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void release_reference(atomic_counted* counted) noexcept
+    {
+        if (counted->counter_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete static_cast<T*>(counted);  // NOLINT(cppcoreguidelines-owning-memory)
+        }
+    }
+
+    [[nodiscard]] static auto reference_count(const atomic_counted* counted) noexcept -> size_t
+    {
+        return counted->counter_.load(std::memory_order_relaxed);
+    }
+};
+
+// per-thread local counters and a global counter of threads, like bias::shared_ptr
+//
+// The reference an object starts out with is not counted by any thread, so creating one claims no local counter and
+// the first thread to take a reference of its own counts it from there.
+template<typename T>
+struct bias_counted : private bias::detail::control_block
+{
+    using counting_base = bias_counted;
+
+  protected:
+    bias_counted() noexcept
+        : bias::detail::control_block(bias::detail::uncounted)
+    {
+        this->manage = &bias::detail::control_block::manager_of<bias_counted>;
+    }
+
+    // a copy is a new object with its own count
+    bias_counted(const bias_counted& /*other*/) noexcept
+        : bias::detail::control_block(bias::detail::uncounted)
+    {
+        this->manage = &bias::detail::control_block::manager_of<bias_counted>;
+    }
+
+    auto operator=(const bias_counted& /*other*/) noexcept -> bias_counted&
+    {
+        return *this;
+    }
+
+    ~bias_counted() noexcept = default;
+
+  private:
+    template<typename U>
+    friend struct intrusive_ptr;
+    friend struct wind::detail::managed_control_block<bias::detail::control_block>;
+
+    // there are no weak references, so the object is destroyed together with its count
+    void destroy_data() noexcept {}
+
+    void deallocate() noexcept
+    {
+        delete static_cast<T*>(this);  // NOLINT(cppcoreguidelines-owning-memory)
+    }
+
+    [[nodiscard]] auto get_data() noexcept -> void*
+    {
+        return static_cast<T*>(this);
+    }
+
+    static void add_reference(bias_counted* counted) noexcept
+    {
+        bias::detail::add_local_reference(counted, counted->key);
+    }
+
+    static void release_reference(bias_counted* counted) noexcept
+    {
+        bias::detail::release_local_reference(counted, counted->key);
+    }
+
+    // number of threads holding references, not the number of references, and at least one while any remain
+    [[nodiscard]] static auto reference_count(const bias_counted* counted) noexcept -> size_t
+    {
+        auto global = counted->global_counter.load(std::memory_order_relaxed);
+        auto holders = global & bias::detail::control_block::holder_mask;
+        return holders == 0 && global != 0 ? 1 : holders;
+    }
+};
+
+template<typename T>
+struct intrusive_ptr
+{
+    using element_type = T;
+    using counter_type = size_t;
+
+  private:
+    using counting_base = typename std::remove_cv_t<T>::counting_base;
+
+    template<typename U>
+    friend struct intrusive_ptr;
+
+    T* ptr_ {nullptr};
+
+  public:
+    intrusive_ptr() = default;
+
+    // takes a new reference to an object that is already owned, for example from within one of its member functions
+    explicit intrusive_ptr(T* ptr) noexcept
+        : ptr_(ptr)
+    {
+        this->inc();
+    }
+
+    // takes over the reference a new object starts out with
+    intrusive_ptr(T* ptr, adopt_reference_t /*adopt*/) noexcept
+        : ptr_(ptr)
+    {
+    }
+
+    template<typename U>
+        requires std::is_convertible_v<U*, T*>
+    intrusive_ptr(const intrusive_ptr<U>& other) noexcept  // NOLINT(google-explicit-constructor)
+        : ptr_(other.ptr_)
+    {
+        this->inc();
+    }
+
+    template<typename U>
+        requires std::is_convertible_v<U*, T*>
+    intrusive_ptr(intrusive_ptr<U>&& other) noexcept  // NOLINT(google-explicit-constructor)
+        : ptr_(other.ptr_)
+    {
+        other.ptr_ = nullptr;
+    }
+
+    intrusive_ptr(const intrusive_ptr& other) noexcept
+        : ptr_(other.ptr_)
+    {
+        this->inc();
+    }
+
+    intrusive_ptr(intrusive_ptr&& other) noexcept
+        : ptr_(other.ptr_)
+    {
+        other.ptr_ = nullptr;
+    }
+
+    auto operator=(const intrusive_ptr& other) noexcept -> intrusive_ptr&
+    {
+        if (this->ptr_ != other.ptr_) {
+            this->decrement_and_maybe_delete();
+            this->ptr_ = other.ptr_;
+            this->inc();
+        }
+        return *this;
+    }
+
+    auto operator=(intrusive_ptr&& other) noexcept -> intrusive_ptr&
+    {
+        if (this == &other) {
+            return *this;
+        }
+
+        this->decrement_and_maybe_delete();
+        this->ptr_ = other.ptr_;
+        other.ptr_ = nullptr;
+        return *this;
+    }
+
+    ~intrusive_ptr() noexcept
+    {
+        this->decrement_and_maybe_delete();
+    }
+
+    [[nodiscard]] auto get() noexcept -> element_type*
+    {
+        return this->ptr_;
+    }
+
+    [[nodiscard]] auto get() const noexcept -> const element_type*
+    {
+        return this->ptr_;
+    }
+
+    [[nodiscard]] auto operator*() const -> const element_type&
+    {
+        return *this->ptr_;
+    }
+
+    [[nodiscard]] auto operator*() -> element_type&
+    {
+        return *this->ptr_;
+    }
+
+    [[nodiscard]] auto operator->() const noexcept -> const element_type*
+    {
+        return this->ptr_;
+    }
+
+    [[nodiscard]] auto operator->() noexcept -> element_type*
+    {
+        return this->ptr_;
+    }
+
+    [[nodiscard]] auto use_count() const noexcept -> counter_type
+    {
+        if (this->ptr_ == nullptr) {
+            return 0;
+        }
+        return counting_base::reference_count(this->ptr_);
+    }
+
+    void swap(intrusive_ptr& other) noexcept
+    {
+        std::swap(this->ptr_, other.ptr_);
+    }
+
+    [[nodiscard]] explicit operator bool() const
+    {
+        return this->ptr_ != nullptr;
+    }
+
+  private:
+    void inc() noexcept
+    {
+        if (this->ptr_ != nullptr) {
+            counting_base::add_reference(const_cast<std::remove_cv_t<T>*>(this->ptr_));  // NOLINT
+        }
+    }
+
+    void decrement_and_maybe_delete() noexcept
+    {
+        if (this->ptr_ != nullptr) {
+            counting_base::release_reference(const_cast<std::remove_cv_t<T>*>(this->ptr_));  // NOLINT
+        }
+    }
+};
+
+template<typename T, typename... Args>
+auto make_intrusive(Args&&... args) -> intrusive_ptr<T>
+{
+    return intrusive_ptr<T>(new T(std::forward<Args>(args)...), adopt_reference);  // NOLINT
+}
+
+}  // namespace wind
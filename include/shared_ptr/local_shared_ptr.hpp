@@ -1,236 +1,125 @@
 #pragma once
-#include <memory>
-#include <type_traits>
+#include <cstddef>
+
+#include <shared_ptr/basic_shared_ptr.hpp>
 
 namespace wind::local
 {
 namespace detail
 {
-template<typename T>
-struct control_block
+struct control_block : wind::detail::managed_control_block<control_block>
 {
-    T* data;
-    size_t counter;
-
-    explicit control_block(T* i_data) noexcept
-        : data {i_data}
-        , counter {1}
-    {
-    }
+    size_t counter {1};
+    // number of weak_ptrs, plus one while counter is non-zero
+    size_t weak_counter {1};
 
+    control_block() noexcept = default;
     control_block(const control_block&) noexcept = default;
     control_block(control_block&&) noexcept = default;
     auto operator=(const control_block&) noexcept -> control_block& = default;
     auto operator=(control_block&&) noexcept -> control_block& = default;
 
-    virtual ~control_block() = default;
-
     void inc() noexcept
     {
         this->counter++;
     }
 
-    [[nodiscard]] auto decrement_and_check_zero() noexcept -> bool
+    void inc_weak() noexcept
     {
-        return --this->counter == 0;
+        this->weak_counter++;
     }
-};
-
-template<typename T, typename DeleterF>
-struct control_block_with_deleter final : control_block<T>
-{
-    DeleterF deleter;
 
-    control_block_with_deleter(T* i_data, DeleterF i_deleter) noexcept
-        : control_block<T>(i_data)
-        , deleter {std::move(i_deleter)}
+    [[nodiscard]] auto decrement_and_check_zero() noexcept -> bool
     {
+        return --this->counter == 0;
     }
 
-    control_block_with_deleter(const control_block_with_deleter&) noexcept = default;
-    control_block_with_deleter(control_block_with_deleter&&) noexcept = default;
-    auto operator=(const control_block_with_deleter&) noexcept -> control_block_with_deleter& = default;
-    auto operator=(control_block_with_deleter&&) noexcept -> control_block_with_deleter& = default;
-
-    ~control_block_with_deleter() noexcept override
+    [[nodiscard]] auto decrement_weak_and_check_zero() noexcept -> bool
     {
-        this->deleter(this->data);
-    };
-};
-
-template<typename T, typename DeleterF>
-auto new_control_block_with_deleter(T* ptr, DeleterF&& deleter)
-{
-    return new control_block_with_deleter<T, DeleterF>(ptr, std::forward<DeleterF>(deleter));  // NOLINT
-}
-
-template<typename T>
-struct control_block_with_data final : control_block<T>
-{
-    T val;
+        return --this->weak_counter == 0;
+    }
 
-    template<typename... Args>
-    explicit control_block_with_data(Args&&... args) noexcept
-        : control_block<T>(&this->val)
-        , val {std::forward<Args>(args)...}
+    void release_data() noexcept
     {
+        this->destroy_data();
+        if (this->decrement_weak_and_check_zero()) {
+            this->deallocate();
+        }
     }
 };
 
-template<typename T, typename... Args>
-auto new_control_block_with_data(Args&&... args)
-{
-    return new control_block_with_data<T>(std::forward<Args>(args)...);  // NOLINT
-}
-
 }  // namespace detail
 
-template<typename T>
-struct shared_ptr
+// a plain counter, not thread safe
+struct counting_policy
 {
-    using element_type = typename std::remove_extent_t<T>;
-    using counter_type = size_t;
-
-  private:
-    detail::control_block<T>* control_block_ {nullptr};
-
-  public:
-    shared_ptr() = default;
+    using control_block = detail::control_block;
 
-    explicit shared_ptr(element_type* ptr)
-        : control_block_(detail::new_control_block_with_deleter(ptr, std::default_delete<element_type>()))
+    struct handle
     {
-    }
-
-    template<typename DeleterF>
-    shared_ptr(element_type* ptr, DeleterF&& deleter)
-        : control_block_(detail::new_control_block_with_deleter<element_type>(ptr, std::forward<DeleterF>(deleter)))
-    {
-    }
-
-    explicit shared_ptr(detail::control_block<element_type>* control_block)
-        : control_block_(control_block)
-    {
-    }
+    };
 
-    // stuff
-    shared_ptr(const shared_ptr& other) noexcept
-        : control_block_(other.control_block_)
+    [[nodiscard]] static auto handle_of(control_block* /*control*/) noexcept -> handle
     {
-        this->inc();
+        return {};
     }
 
-    shared_ptr(shared_ptr&& other) noexcept
-        : control_block_(std::move(other.control_block_))
+    static void add_reference(control_block* control, handle /*handle*/) noexcept
     {
-        other.control_block_ = nullptr;
+        control->inc();
     }
 
-    auto operator=(const shared_ptr& other) noexcept -> shared_ptr&
+    static void release_reference(control_block* control, handle /*handle*/) noexcept
     {
-        if (this == &other) {
-            return *this;
-        }
-
-        if (this->control_block_ != other.control_block_) {
-            this->decrement_and_maybe_delete();
-            this->control_block_ = other.control_block_;
-            this->inc();
+        if (control->decrement_and_check_zero()) {
+            control->release_data();
         }
-        return *this;
     }
 
-    auto operator=(shared_ptr&& other) noexcept -> shared_ptr&
+    [[nodiscard]] static auto try_add_reference(control_block* control) noexcept -> bool
     {
-        if (this == &other) {
-            return *this;
+        if (control->counter == 0) {
+            return false;
         }
-
-        this->decrement_and_maybe_delete();
-        this->control_block_ = other.control_block_;
-        other.control_block_ = nullptr;
-        return *this;
+        control->inc();
+        return true;
     }
 
-    ~shared_ptr() noexcept
+    [[nodiscard]] static auto use_count(const control_block* control) noexcept -> size_t
     {
-        this->decrement_and_maybe_delete();
+        return control->counter;
     }
 
-    [[nodiscard]] auto get() noexcept -> element_type*
+    [[nodiscard]] static auto expired(const control_block* control) noexcept -> bool
     {
-        return this->control_block_->data;
+        return control->counter == 0;
     }
 
-    [[nodiscard]] auto get() const noexcept -> const element_type*
+    [[nodiscard]] static auto unique(const control_block* control, handle /*handle*/) noexcept -> bool
     {
-        return this->control_block_->data;
-    }
-
-    [[nodiscard]] auto operator*() const -> const element_type&
-    {
-        return *this->control_block_->data;
-    }
-
-    [[nodiscard]] auto operator*() -> element_type&
-    {
-        return *this->control_block_->data;
-    }
-
-    [[nodiscard]] auto operator->() const noexcept -> const element_type*
-    {
-        return this->control_block_->data;
-    }
-
-    [[nodiscard]] auto operator->() noexcept -> element_type*
-    {
-        return this->control_block_->data;
-    }
-
-    [[nodiscard]] auto use_count() const -> const counter_type&
-    {
-        return this->control_block_->counter;
+        return control->counter == 1;
     }
+};
 
-    [[nodiscard]] auto unique() const -> size_t
-    {
-        return this->control_block_->counter == 1;
-    }
+template<typename T>
+using shared_ptr = basic_shared_ptr<T, counting_policy>;
 
-    void swap(shared_ptr other)
-    {
-        std::swap(this->control_block_, other->control_block_);
-    }
+template<typename T>
+using weak_ptr = basic_weak_ptr<T, counting_policy>;
 
-    [[nodiscard]] explicit operator bool() const
-    {
-        return this->control_block_ != nullptr;
-    }
+template<typename T>
+using borrowed_ptr = basic_borrowed_ptr<T, counting_policy>;
 
-  private:
-    void inc() noexcept
-    {
-        if (this->control_block_ != nullptr) {
-            this->control_block_->inc();
-        }
-    }
+template<typename T>
+using enable_shared_from_this = basic_enable_shared_from_this<T, counting_policy>;
 
-    void decrement_and_maybe_delete() noexcept
-    {
-        if (this->control_block_ != nullptr) {
-            if (this->control_block_->decrement_and_check_zero()) {
-                delete this->control_block_;
-            }
-        }
-    }
-};
+template<typename T>
+inline constexpr wind::detail::make_shared_function<T, counting_policy> make_shared {};
 
-template<typename T, typename... Args>
-auto make_shared(Args&&... args) -> shared_ptr<typename std::remove_extent_t<T>>
-{
-    using element_type = typename std::remove_extent_t<T>;
+template<typename T>
+inline constexpr wind::detail::make_shared_n_function<T, counting_policy> make_shared_n {};
 
-    return shared_ptr<element_type> {detail::new_control_block_with_data<element_type>(std::forward<Args>(args)...)};
-}
+template<typename T>
+inline constexpr wind::detail::allocate_shared_function<T, counting_policy> allocate_shared {};
 
-}  // namespace wind::local
\ No newline at end of file
+}  // namespace wind::local
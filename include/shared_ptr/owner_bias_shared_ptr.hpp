@@ -0,0 +1,361 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <shared_ptr/basic_shared_ptr.hpp>
+
+// Biased reference counting after Choi, Shull and Torrellas, "Biased Reference Counting: Minimizing Atomic
+// Operations in Garbage Collection" (PACT 2018).
+//
+// The thread creating an object owns its control block and counts its copies in a plain counter. Every other thread
+// counts in an atomic shared counter, which goes negative when they release copies the owner made. The first thread
+// taking it below zero queues the control block on the owner, which then merges its own count into the shared counter
+// and gives up ownership. The owner also merges once its own count drops to zero. After the merge the shared counter
+// holds every copy, and reaching zero there releases the object.
+//
+// An object whose last copies are released by other threads is therefore only released once its owner merges its
+// queue, which happens whenever one of the owner's own counts drops to zero, when it creates an object, on
+// merge_queued() and when the owner exits.
+namespace wind::owner_bias
+{
+namespace detail
+{
+struct control_block;
+
+// A thread's queue of control blocks to merge. Records are never freed, so control blocks can keep naming owners that
+// have exited, and stay linked in a process-wide list.
+struct owner_record
+{
+    std::atomic<control_block*> queue {nullptr};
+    owner_record* next_record {nullptr};
+};
+
+inline auto new_owner_record() -> owner_record*
+{
+    static std::atomic<owner_record*> records {nullptr};
+
+    auto* record = new owner_record();  // NOLINT(cppcoreguidelines-owning-memory)
+    record->next_record = records.load(std::memory_order_relaxed);
+    while (!records.compare_exchange_weak(record->next_record, record, std::memory_order_release)) {
+    }
+    return record;
+}
+
+// the calling thread's record, nullptr until it created a control block and again after it exited
+inline thread_local owner_record* current_owner = nullptr;
+
+inline auto closed_queue() noexcept -> control_block*
+{
+    static char closed = 0;
+    return reinterpret_cast<control_block*>(&closed);  // NOLINT
+}
+
+struct control_block : wind::detail::managed_control_block<control_block>
+{
+    static constexpr std::int64_t merged_flag = 1;
+    static constexpr std::int64_t queued_flag = 2;
+    static constexpr int count_shift = 2;
+    static constexpr std::int64_t count_one = std::int64_t {1} << count_shift;
+
+    // the thread counting copies in biased, nullptr once merged
+    std::atomic<owner_record*> owner;
+    // copies of the owner, only touched by the owner
+    size_t biased {1};
+    // copies of other threads in the upper bits, and the merged and queued flags in the lowest two
+    std::atomic<std::int64_t> shared {0};
+    // number of weak_ptrs and merge queue entries, plus one while the object is alive
+    std::atomic<size_t> weak_counter {1};
+    control_block* next_queued {nullptr};
+
+    control_block() noexcept;
+    control_block(const control_block&) = delete;
+    control_block(control_block&&) = delete;
+    auto operator=(const control_block&) -> control_block& = delete;
+    auto operator=(control_block&&) -> control_block& = delete;
+    ~control_block() noexcept = default;
+
+    [[nodiscard]] static auto count_of(std::int64_t shared_value) noexcept -> std::int64_t
+    {
+        return shared_value >> count_shift;
+    }
+
+    [[nodiscard]] auto is_owned_by_this_thread() const noexcept -> bool
+    {
+        auto* current = this->owner.load(std::memory_order_relaxed);
+        return current == current_owner && current != nullptr;
+    }
+
+    void inc() noexcept
+    {
+        if (this->is_owned_by_this_thread()) {
+            this->biased++;
+        } else {
+            this->shared.fetch_add(count_one, std::memory_order_relaxed);
+        }
+    }
+
+    // counts a new copy unless the object was already released, for weak_ptr::lock
+    [[nodiscard]] auto try_inc() noexcept -> bool
+    {
+        if (this->is_owned_by_this_thread()) {
+            // the owner merges as soon as its own copies are gone, so it still holds one
+            this->biased++;
+            return true;
+        }
+        // until merged the owner holds copies, after that the shared counter holds them all
+        auto old = this->shared.load(std::memory_order_relaxed);
+        do {
+            if ((old & merged_flag) != 0 && count_of(old) == 0) {
+                return false;
+            }
+        } while (!this->shared.compare_exchange_weak(
+            old, old + count_one, std::memory_order_acquire, std::memory_order_relaxed));
+        return true;
+    }
+
+    [[nodiscard]] auto decrement_and_check_zero() noexcept -> bool;
+
+    // moves the owner's copies into the shared counter, returns true if no copies remain
+    [[nodiscard]] auto merge() noexcept -> bool
+    {
+        auto biased_count = static_cast<std::int64_t>(this->biased);
+        this->biased = 0;
+        // the flag is set before the owner is cleared, so a thread seeing no owner cannot queue anymore
+        auto old = this->shared.fetch_add(biased_count * count_one + merged_flag, std::memory_order_acq_rel);
+        this->owner.store(nullptr, std::memory_order_release);
+        return count_of(old) + biased_count == 0;
+    }
+
+    void inc_weak() noexcept
+    {
+        this->weak_counter++;
+    }
+
+    [[nodiscard]] auto decrement_weak_and_check_zero() noexcept -> bool
+    {
+        return --this->weak_counter == 0;
+    }
+
+    void release_weak() noexcept
+    {
+        if (this->decrement_weak_and_check_zero()) {
+            this->deallocate();
+        }
+    }
+
+    void release_data() noexcept
+    {
+        this->destroy_data();
+        this->release_weak();
+    }
+
+  private:
+    [[nodiscard]] auto decrement_shared() noexcept -> bool;
+};
+
+// merges a list of queued control blocks taken from the calling thread's queue
+inline void merge_queued(control_block* queued) noexcept
+{
+    while (queued != nullptr) {
+        auto* next = queued->next_queued;
+        if ((queued->shared.load(std::memory_order_relaxed) & control_block::merged_flag) == 0 && queued->merge()) {
+            queued->release_data();
+        }
+        queued->release_weak();
+        queued = next;
+    }
+}
+
+// registers the calling thread as an owner, and merges what is queued on it when the thread exits
+struct owner_registration
+{
+    owner_registration()
+    {
+        current_owner = new_owner_record();
+    }
+
+    owner_registration(const owner_registration&) = delete;
+    owner_registration(owner_registration&&) = delete;
+    auto operator=(const owner_registration&) -> owner_registration& = delete;
+    auto operator=(owner_registration&&) -> owner_registration& = delete;
+
+    ~owner_registration()
+    {
+        auto* record = current_owner;
+        current_owner = nullptr;
+        // anything queued later is merged by the thread queueing it
+        merge_queued(record->queue.exchange(closed_queue(), std::memory_order_acq_rel));
+    }
+};
+
+inline auto this_owner() -> owner_record*
+{
+    if (current_owner == nullptr) {
+        thread_local owner_registration registration;
+    }
+    return current_owner;
+}
+
+inline control_block::control_block() noexcept
+    : owner(this_owner())
+{
+    if (this->owner.load(std::memory_order_relaxed) == nullptr) {
+        // created during thread exit, the only copy is counted as merged right away
+        this->biased = 0;
+        this->shared.store(count_one | merged_flag, std::memory_order_relaxed);
+    } else if (current_owner->queue.load(std::memory_order_relaxed) != nullptr) {
+        merge_queued(current_owner->queue.exchange(nullptr, std::memory_order_acquire));
+    }
+}
+
+inline void enqueue(owner_record* record, control_block* control) noexcept
+{
+    auto* head = record->queue.load(std::memory_order_acquire);
+    do {
+        if (head == closed_queue()) {
+            // the owner exited, so nobody else touches its count anymore
+            if (control->merge()) {
+                control->release_data();
+            }
+            control->release_weak();
+            return;
+        }
+        control->next_queued = head;
+    } while (!record->queue.compare_exchange_weak(
+        head, control, std::memory_order_acq_rel, std::memory_order_acquire));
+}
+
+inline auto control_block::decrement_and_check_zero() noexcept -> bool
+{
+    if (this->is_owned_by_this_thread()) {
+        if (--this->biased != 0) {
+            return false;
+        }
+        auto* record = current_owner;
+        auto release = this->merge();
+        merge_queued(record->queue.exchange(nullptr, std::memory_order_acquire));
+        return release;
+    }
+    return this->decrement_shared();
+}
+
+inline auto control_block::decrement_shared() noexcept -> bool
+{
+    // read before queueing, the owner is only cleared after the merged flag is set
+    auto* record = this->owner.load(std::memory_order_acquire);
+
+    auto old = this->shared.load(std::memory_order_relaxed);
+    auto desired = old;
+    auto queues = false;
+    auto holds_entry = false;
+    do {
+        desired = old - count_one;
+        queues = count_of(desired) < 0 && (old & (queued_flag | merged_flag)) == 0;
+        if (queues) {
+            desired |= queued_flag;
+            if (!holds_entry) {
+                // the queue entry keeps the control block alive until the owner merged it
+                this->inc_weak();
+                holds_entry = true;
+            }
+        }
+    } while (!this->shared.compare_exchange_weak(old, desired, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    if (queues) {
+        enqueue(record, this);
+        return false;
+    }
+    if (holds_entry) {
+        // still held by the object itself
+        this->weak_counter--;
+    }
+    return (desired & merged_flag) != 0 && count_of(desired) == 0;
+}
+
+}  // namespace detail
+
+// merges the control blocks other threads queued on the calling thread, which releases those without copies left
+inline void merge_queued()
+{
+    if (detail::current_owner != nullptr) {
+        detail::merge_queued(detail::current_owner->queue.exchange(nullptr, std::memory_order_acquire));
+    }
+}
+
+// Biased counting as described above. The handle is empty, as the owner has to be compared on every count anyway.
+struct counting_policy
+{
+    using control_block = detail::control_block;
+
+    struct handle
+    {
+    };
+
+    [[nodiscard]] static auto handle_of(control_block* /*control*/) noexcept -> handle
+    {
+        return {};
+    }
+
+    static void add_reference(control_block* control, handle /*handle*/) noexcept
+    {
+        control->inc();
+    }
+
+    static void release_reference(control_block* control, handle /*handle*/) noexcept
+    {
+        if (control->decrement_and_check_zero()) {
+            control->release_data();
+        }
+    }
+
+    [[nodiscard]] static auto try_add_reference(control_block* control) noexcept -> bool
+    {
+        return control->try_inc();
+    }
+
+    // exact on the owning thread and once merged, other threads cannot see the owner's copies
+    [[nodiscard]] static auto use_count(const control_block* control) noexcept -> size_t
+    {
+        auto shared = control_block::count_of(control->shared.load());
+        if (control->is_owned_by_this_thread()) {
+            shared += static_cast<std::int64_t>(control->biased);
+        }
+        return static_cast<size_t>(shared);
+    }
+
+    // an object whose last copies were released by other threads only expires once its owner merged them
+    [[nodiscard]] static auto expired(const control_block* control) noexcept -> bool
+    {
+        auto shared = control->shared.load();
+        return (shared & control_block::merged_flag) != 0 && control_block::count_of(shared) == 0;
+    }
+
+    [[nodiscard]] static auto unique(const control_block* control, handle /*handle*/) noexcept -> bool
+    {
+        return use_count(control) == 1;
+    }
+};
+
+template<typename T>
+using shared_ptr = basic_shared_ptr<T, counting_policy>;
+
+template<typename T>
+using weak_ptr = basic_weak_ptr<T, counting_policy>;
+
+template<typename T>
+using borrowed_ptr = basic_borrowed_ptr<T, counting_policy>;
+
+template<typename T>
+using enable_shared_from_this = basic_enable_shared_from_this<T, counting_policy>;
+
+template<typename T>
+inline constexpr wind::detail::make_shared_function<T, counting_policy> make_shared {};
+
+template<typename T>
+inline constexpr wind::detail::make_shared_n_function<T, counting_policy> make_shared_n {};
+
+template<typename T>
+inline constexpr wind::detail::allocate_shared_function<T, counting_policy> allocate_shared {};
+
+}  // namespace wind::owner_bias
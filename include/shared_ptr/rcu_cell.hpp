@@ -0,0 +1,125 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <tuple>
+#include <utility>
+
+#include <shared_ptr/bias_atomic_shared_ptr.hpp>
+#include <shared_ptr/bias_shared_ptr.hpp>
+#include <shared_ptr/thread_local_storage.hpp>
+
+namespace wind::bias
+{
+namespace detail
+{
+// a reader's copy of a cell's value, and the version of the cell it was taken at
+template<typename T>
+struct cached_value
+{
+    size_t version {0};
+    shared_ptr<T> value;
+};
+
+// drops the copies an exiting thread still caches
+template<typename T>
+struct release_cached_value
+{
+    // the copies are counted in local_count_storage, which has to outlive them
+    static void init_thread()
+    {
+        local_count_storage::init_thread();
+    }
+
+    static void on_thread_exit(cached_value<T>& cached) noexcept
+    {
+        cached.value = shared_ptr<T>();
+    }
+};
+
+// Versions are unique across all cells, so a thread's leftover copy for a key that has since been reused by another
+// cell never matches.
+inline auto next_cell_version() noexcept -> size_t
+{
+    static auto versions = std::atomic<size_t> {1};
+    return versions.fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // namespace detail
+
+// A value that is read often and replaced rarely, like a configuration or a routing table. store() publishes a new
+// value. Every reading thread keeps its own copy of the value, which read() hands out for as long as the cell's
+// version has not changed since, so a read is a single relaxed load and touches no counter. A thread's copy is only
+// refreshed by its next read, so it keeps the previous value alive until then or until the thread exits.
+template<typename T>
+struct rcu_cell
+{
+    using value_type = shared_ptr<T>;
+
+  private:
+    using cache_storage = thread_local_storage<detail::cached_value<T>, detail::release_cached_value<T>>;
+
+    atomic_shared_ptr<T> current_;
+    std::atomic<size_t> version_ {detail::next_cell_version()};
+    // process-wide key of the per-thread copies
+    typename cache_storage::key_t key_ {cache_storage::create_key({})};
+    // Stores are serialized, otherwise a reader could cache the value of one store under the version of another
+    // that was published after it.
+    std::mutex store_mutex_;
+
+    auto refresh() const -> detail::cached_value<T>&
+    {
+        // loaded before the value, so a store racing with this at worst leaves an outdated version to be refreshed
+        auto version = this->version_.load(std::memory_order_acquire);
+        auto& cached = std::get<0>(cache_storage::get_or_create(this->key_, {})).get();
+        cached = detail::cached_value<T> {version, this->current_.load()};
+        return cached;
+    }
+
+  public:
+    rcu_cell() = default;
+
+    explicit rcu_cell(value_type initial)
+        : current_(std::move(initial))
+    {
+    }
+
+    rcu_cell(const rcu_cell&) = delete;
+    rcu_cell(rcu_cell&&) = delete;
+    auto operator=(const rcu_cell&) -> rcu_cell& = delete;
+    auto operator=(rcu_cell&&) -> rcu_cell& = delete;
+
+    // Copies other threads still cache are released when they read a cell reusing the key or exit.
+    ~rcu_cell()
+    {
+        if (cache_storage::contains(this->key_)) {
+            cache_storage::return_key(this->key_);
+        }
+        cache_storage::destroy_key(this->key_);
+    }
+
+    // The current value without taking a reference. It stays valid until the calling thread reads this cell again.
+    [[nodiscard]] auto read() const -> borrowed_ptr<T>
+    {
+        auto* cached = cache_storage::find(this->key_);
+        if (cached == nullptr || cached->version != this->version_.load(std::memory_order_relaxed)) {
+            cached = &this->refresh();
+        }
+        return borrowed_ptr<T>(cached->value);
+    }
+
+    // the current value, which may be kept beyond the next read
+    [[nodiscard]] auto load() const -> value_type
+    {
+        return this->read().to_shared();
+    }
+
+    void store(value_type desired)
+    {
+        auto lock = std::lock_guard(this->store_mutex_);
+        this->current_.store(std::move(desired));
+        this->version_.store(detail::next_cell_version(), std::memory_order_release);
+    }
+};
+
+}  // namespace wind::bias
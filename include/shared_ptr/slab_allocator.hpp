@@ -0,0 +1,235 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace wind
+{
+namespace detail
+{
+// Size-class slab pools for small blocks, with one set of pools per thread.
+//
+// Every thread owns a cache with a free list (its magazine) and a bump region per size class. Blocks are carved out
+// of chunks aligned to their own size, whose header names the owning cache, so a block is freed by pushing it onto
+// the free list of its owner. Blocks freed by other threads go onto a lock-free stack of the owner, which the owner
+// takes over as a whole once its own free list runs dry. Memory is kept for reuse and never returned to the system.
+// The caches of exited threads are handed to new threads together with their chunks.
+struct slab_pool
+{
+    static constexpr std::size_t granularity = 16;
+    static constexpr std::size_t class_count = 16;
+    static constexpr std::size_t max_size = granularity * class_count;
+    static constexpr std::size_t chunk_size = std::size_t {1} << 16;
+
+  private:
+    struct free_block
+    {
+        free_block* next;
+    };
+
+    struct size_class
+    {
+        free_block* free_list {nullptr};
+        std::byte* bump {nullptr};
+        std::byte* bump_end {nullptr};
+        // blocks freed by other threads
+        std::atomic<free_block*> remote_frees {nullptr};
+    };
+
+    struct thread_cache
+    {
+        std::array<size_class, class_count> classes;
+    };
+
+    struct alignas(granularity) chunk_header
+    {
+        thread_cache* owner;
+        std::size_t class_index;
+    };
+
+    struct cache_pool
+    {
+        std::mutex mutex;
+        std::vector<thread_cache*> orphans;
+        // serves threads that allocate or free while their own cache is already torn down
+        thread_cache exiting;
+    };
+
+    static auto caches() -> cache_pool&
+    {
+        static auto* pool = new cache_pool();  // NOLINT(cppcoreguidelines-owning-memory), outlives all threads
+        return *pool;
+    }
+
+    static auto current() -> thread_cache*&
+    {
+        thread_local thread_cache* cache = nullptr;
+        return cache;
+    }
+
+    static auto torn_down() -> bool&
+    {
+        thread_local bool done = false;
+        return done;
+    }
+
+    // adopts a cache for the calling thread and orphans it again on thread exit
+    struct cache_owner
+    {
+        cache_owner()
+        {
+            auto& pool = caches();
+            auto lock = std::lock_guard(pool.mutex);
+            if (pool.orphans.empty()) {
+                current() = new thread_cache();  // NOLINT(cppcoreguidelines-owning-memory)
+            } else {
+                current() = pool.orphans.back();
+                pool.orphans.pop_back();
+            }
+        }
+
+        cache_owner(const cache_owner&) = delete;
+        cache_owner(cache_owner&&) = delete;
+        auto operator=(const cache_owner&) -> cache_owner& = delete;
+        auto operator=(cache_owner&&) -> cache_owner& = delete;
+
+        ~cache_owner()
+        {
+            auto& pool = caches();
+            auto lock = std::lock_guard(pool.mutex);
+            pool.orphans.push_back(current());
+            current() = nullptr;
+            torn_down() = true;
+        }
+    };
+
+    // the calling thread's cache, or nullptr once the thread is exiting
+    static auto local_cache() -> thread_cache*
+    {
+        if (current() == nullptr && !torn_down()) {
+            thread_local cache_owner owner;
+        }
+        return current();
+    }
+
+    [[nodiscard]] static auto class_of(std::size_t size) noexcept -> std::size_t
+    {
+        return (size - 1) / granularity;
+    }
+
+    [[nodiscard]] static auto header_of(void* block) noexcept -> chunk_header*
+    {
+        auto bits = reinterpret_cast<std::uintptr_t>(block) & ~(chunk_size - 1);  // NOLINT
+        return reinterpret_cast<chunk_header*>(bits);  // NOLINT
+    }
+
+    static auto allocate_from(thread_cache* cache, std::size_t class_index) -> void*
+    {
+        auto& pool = cache->classes[class_index];
+        if (pool.free_list == nullptr && pool.remote_frees.load(std::memory_order_relaxed) != nullptr) {
+            pool.free_list = pool.remote_frees.exchange(nullptr, std::memory_order_acquire);
+        }
+        if (auto* block = pool.free_list; block != nullptr) {
+            pool.free_list = block->next;
+            return block;
+        }
+
+        auto block_size = (class_index + 1) * granularity;
+        if (pool.bump == pool.bump_end) {
+            auto* chunk = static_cast<std::byte*>(::operator new(chunk_size, std::align_val_t {chunk_size}));
+            ::new (chunk) chunk_header {cache, class_index};
+            pool.bump = chunk + sizeof(chunk_header);
+            pool.bump_end = pool.bump + (chunk_size - sizeof(chunk_header)) / block_size * block_size;
+        }
+        auto* block = pool.bump;
+        pool.bump += block_size;
+        return block;
+    }
+
+    static void push_remote(void* block) noexcept
+    {
+        auto* header = header_of(block);
+        auto& remote_frees = header->owner->classes[header->class_index].remote_frees;
+        auto* freed = ::new (block) free_block {remote_frees.load(std::memory_order_relaxed)};
+        while (!remote_frees.compare_exchange_weak(
+            freed->next, freed, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
+  public:
+    // a block of at least size bytes, aligned to granularity, size must not exceed max_size
+    static auto allocate(std::size_t size) -> void*
+    {
+        if (auto* cache = local_cache(); cache != nullptr) {
+            return allocate_from(cache, class_of(size));
+        }
+
+        auto& pool = caches();
+        auto lock = std::lock_guard(pool.mutex);
+        return allocate_from(&pool.exiting, class_of(size));
+    }
+
+    static void deallocate(void* block) noexcept
+    {
+        auto* header = header_of(block);
+        if (header->owner != local_cache()) {
+            push_remote(block);
+            return;
+        }
+
+        auto& pool = header->owner->classes[header->class_index];
+        pool.free_list = ::new (block) free_block {pool.free_list};
+    }
+};
+
+}  // namespace detail
+
+// Standard allocator drawing single small objects from the per-thread slab pools, anything else from std::allocator.
+template<typename T>
+struct slab_allocator
+{
+    using value_type = T;
+
+    slab_allocator() noexcept = default;
+
+    template<typename U>
+    slab_allocator(const slab_allocator<U>& /*other*/) noexcept  // NOLINT(google-explicit-constructor)
+    {
+    }
+
+    [[nodiscard]] static constexpr auto uses_slab(std::size_t n) noexcept -> bool
+    {
+        return n == 1 && sizeof(T) <= detail::slab_pool::max_size && alignof(T) <= detail::slab_pool::granularity;
+    }
+
+    [[nodiscard]] auto allocate(std::size_t n) -> T*
+    {
+        if (uses_slab(n)) {
+            return static_cast<T*>(detail::slab_pool::allocate(sizeof(T)));
+        }
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* ptr, std::size_t n) noexcept
+    {
+        if (uses_slab(n)) {
+            detail::slab_pool::deallocate(ptr);
+            return;
+        }
+        std::allocator<T>().deallocate(ptr, n);
+    }
+
+    template<typename U>
+    auto operator==(const slab_allocator<U>& /*other*/) const noexcept -> bool
+    {
+        return true;
+    }
+};
+
+}  // namespace wind
@@ -1,51 +1,277 @@
-#include <cinttypes>
-#include <unordered_map>
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 namespace wind
 {
-template<typename T>
+// Per-thread values addressed by a process-wide key. Keys are handed out by a process-wide allocator, so the same key
+// names the same logical value on every thread, and each thread resolves it against its own flat slot array. A lookup
+// is therefore a bounds check and a single indexed load. Destroyed keys are recycled through a per-thread cache backed
+// by a shared pool, so creating a key does not allocate or touch shared state in the steady state.
+//
+// The price of the flat array is memory: a thread's array grows to the highest key it ever held a value for, so each
+// thread pays for the peak number of live keys in the process, not for the keys it uses itself, and never shrinks.
+// Destroyed keys are reused before new ones are handed out, so the highest key stays close to the largest number of
+// keys alive at once. memory_usage() reports what the calling thread holds.
+//
+// If ExitHook is given, ExitHook::on_thread_exit(value) is called for every value a thread still holds when it exits.
+// Values the hook creates or touches again are handed to it as well, until none remain. If it also has a static
+// init_thread(), that is called before a thread's values are created, so other storages the hook uses outlive them.
+template<typename T, typename ExitHook = void>
 struct thread_local_storage
 {
     using key_t = std::size_t;
 
     static constexpr std::size_t initial_storage = 1024;
+    static constexpr std::size_t key_batch_size = 64;
 
   private:
-    static auto values() -> std::unordered_map<key_t, T>&
+    struct slot
     {
-        thread_local std::unordered_map<key_t, T> values = std::unordered_map<key_t, T>(initial_storage);
-        return values;
+        T value {};
+        bool occupied {false};
+    };
+
+    struct key_pool
+    {
+        std::mutex mutex;
+        std::vector<key_t> free_keys;
+        key_t next_key {0};
+    };
+
+    static auto shared_keys() -> key_pool&
+    {
+        static key_pool pool;
+        return pool;
+    }
+
+    // Keys freed by this thread. They are given back to the shared pool in batches, and all at once on thread exit.
+    struct key_cache
+    {
+        std::vector<key_t> free_keys;
+
+        key_cache()
+        {
+            this->free_keys.reserve(2 * key_batch_size);
+        }
+
+        key_cache(const key_cache&) = delete;
+        key_cache(key_cache&&) = delete;
+        auto operator=(const key_cache&) -> key_cache& = delete;
+        auto operator=(key_cache&&) -> key_cache& = delete;
+
+        ~key_cache()
+        {
+            auto& pool = shared_keys();
+            auto lock = std::lock_guard(pool.mutex);
+            pool.free_keys.insert(pool.free_keys.end(), this->free_keys.begin(), this->free_keys.end());
+        }
+
+        void refill()
+        {
+            auto& pool = shared_keys();
+            auto lock = std::lock_guard(pool.mutex);
+            if (pool.free_keys.empty()) {
+                for (std::size_t i = 0; i < key_batch_size; i++) {
+                    this->free_keys.push_back(pool.next_key + key_batch_size - 1 - i);
+                }
+                pool.next_key += key_batch_size;
+                return;
+            }
+
+            auto count = std::min(key_batch_size, pool.free_keys.size());
+            auto first = pool.free_keys.end() - static_cast<std::ptrdiff_t>(count);
+            this->free_keys.insert(this->free_keys.end(), first, pool.free_keys.end());
+            pool.free_keys.erase(first, pool.free_keys.end());
+        }
+
+        void spill()
+        {
+            auto& pool = shared_keys();
+            auto lock = std::lock_guard(pool.mutex);
+            auto first = this->free_keys.end() - static_cast<std::ptrdiff_t>(key_batch_size);
+            pool.free_keys.insert(pool.free_keys.end(), first, this->free_keys.end());
+            this->free_keys.erase(first, this->free_keys.end());
+        }
+    };
+
+    static auto keys() -> key_cache&
+    {
+        thread_local key_cache keys;
+        return keys;
+    }
+
+    struct thread_values
+    {
+        std::vector<slot> slots;
+
+        thread_values()
+        {
+            // the exit hook may give keys back, so the key cache has to outlive the values
+            static_cast<void>(keys());
+            if constexpr (requires { ExitHook::init_thread(); }) {
+                ExitHook::init_thread();
+            }
+            this->slots.reserve(initial_storage);
+        }
+
+        thread_values(const thread_values&) = delete;
+        thread_values(thread_values&&) = delete;
+        auto operator=(const thread_values&) -> thread_values& = delete;
+        auto operator=(thread_values&&) -> thread_values& = delete;
+
+        ~thread_values()
+        {
+            if constexpr (!std::is_void_v<ExitHook>) {
+                while (true) {
+                    auto remaining = std::vector<slot>();
+                    remaining.swap(this->slots);
+                    auto any_occupied = false;
+                    for (auto& current : remaining) {
+                        if (current.occupied) {
+                            any_occupied = true;
+                            ExitHook::on_thread_exit(current.value);
+                        }
+                    }
+                    if (!any_occupied) {
+                        break;
+                    }
+                }
+            }
+        }
+    };
+
+    static auto values() -> std::vector<slot>&
+    {
+        thread_local thread_values values;
+        return values.slots;
+    }
+
+    // grows the array up to the key, see the memory trade-off above
+    static auto slot_for(key_t key) -> slot&
+    {
+        auto& slots = values();
+        if (key >= slots.size()) {
+            slots.resize(key + 1);
+        }
+        return slots[key];
     }
 
   public:
+    // Creates the calling thread's storage, so it outlives thread_local objects that are created afterwards and use it
+    // from their destructors.
+    static auto init_thread() -> void
+    {
+        static_cast<void>(keys());
+        static_cast<void>(values());
+    }
+
+    // Allocates a new process-wide key, which no thread holds a value for yet.
+    static auto create_key() -> key_t
+    {
+        auto& cache = keys();
+        if (cache.free_keys.empty()) {
+            cache.refill();
+        }
+        auto key = cache.free_keys.back();
+        cache.free_keys.pop_back();
+        return key;
+    }
+
+    // Allocates a new process-wide key and stores initial_val for it on the calling thread.
     static auto create_key(T initial_val) -> key_t
     {
-        auto key = key_t {values().size()};
-        values().emplace(key, initial_val);
+        auto key = create_key();
+        slot_for(key) = slot {std::move(initial_val), true};
         return key;
     }
 
-    static auto get_or_create(key_t* key, T initial_val) -> std::tuple<std::reference_wrapper<T>, bool>
+    // Gives the key back to the process-wide allocator. No thread may hold a value for it anymore.
+    static auto destroy_key(key_t key) -> void
+    {
+        auto& cache = keys();
+        cache.free_keys.push_back(key);
+        if (cache.free_keys.size() >= 2 * key_batch_size) {
+            cache.spill();
+        }
+    }
+
+    static auto get_or_create(key_t key, T initial_val) -> std::tuple<std::reference_wrapper<T>, bool>
+    {
+        auto& slots = values();
+        if (key < slots.size()) {
+            auto& current = slots[key];
+            if (current.occupied) {
+                return {current.value, true};
+            }
+            current = slot {std::move(initial_val), true};
+            return {current.value, false};
+        }
+
+        auto& current = slot_for(key);
+        current = slot {std::move(initial_val), true};
+        return {current.value, false};
+    }
+
+    // the calling thread's value for the key, or nullptr if it holds none
+    static auto find(key_t key) -> T*
     {
-        if (auto it = values().find(*key); it != values().end()) {
-            return {it->second, true};
+        auto& slots = values();
+        if (key < slots.size() && slots[key].occupied) {
+            return &slots[key].value;
         }
-        *key = create_key(initial_val);
-        return {values().at(*key), false};
+        return nullptr;
     }
 
     static auto contains(key_t key) -> bool
     {
-        return values().contains(key);
+        auto& slots = values();
+        return key < slots.size() && slots[key].occupied;
     }
 
     static auto get(key_t key) -> T&
     {
-        return values().at(key);
+        return values().at(key).value;
     }
+
+    // The calling thread's values, resolved once for many lookups in a row. It stays valid while the thread runs, also
+    // across calls that add values for new keys.
+    struct thread_view
+    {
+        std::vector<slot>* slots;
+
+        [[nodiscard]] auto find(key_t key) const noexcept -> T*
+        {
+            if (key < this->slots->size() && (*this->slots)[key].occupied) {
+                return &(*this->slots)[key].value;
+            }
+            return nullptr;
+        }
+    };
+
+    static auto this_thread() -> thread_view
+    {
+        return thread_view {&values()};
+    }
+
+    // Heap bytes held by the calling thread's slots and key cache, which includes the slots of every key below the
+    // highest one the thread held a value for. Creates the storage if the thread has none yet.
+    static auto memory_usage() -> std::size_t
+    {
+        return values().capacity() * sizeof(slot) + keys().free_keys.capacity() * sizeof(key_t);
+    }
+
+    // Drops the calling thread's value for the key. The key itself stays allocated.
     static auto return_key(key_t key) -> void
     {
-        values().erase(key);
+        auto& current = values()[key];
+        current.value = T {};
+        current.occupied = false;
     }
 };
 
@@ -0,0 +1,200 @@
+#include <atomic>
+#include <ranges>
+#include <thread>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <shared_ptr/atomic_counting_shared_ptr.hpp>
+
+TEST_SUITE("atomic::shared_ptr")  // NOLINT
+{
+    TEST_CASE("atomic::shared_ptr: make_shared works")  // NOLINT
+    {
+        auto my_shared = wind::atomic::make_shared<int>(42);
+        CHECK(*my_shared == 42);
+        CHECK(my_shared.use_count() == 1);
+        CHECK(my_shared.unique());
+    }
+
+    TEST_CASE("atomic::shared_ptr: copies count references")  // NOLINT
+    {
+        auto my_shared = wind::atomic::make_shared<int>(42);
+        auto copy = my_shared;
+        CHECK(*copy == 42);
+        CHECK(my_shared.use_count() == 2);
+        auto moved = std::move(copy);
+        CHECK(my_shared.use_count() == 2);
+        CHECK_FALSE(my_shared.unique());
+    }
+
+    struct deleter_ref
+    {
+        bool* was_deleted = nullptr;
+
+        deleter_ref() = default;
+        deleter_ref(const deleter_ref&) = delete;
+        deleter_ref(deleter_ref&&) = delete;
+        auto operator=(const deleter_ref&) -> deleter_ref& = delete;
+        auto operator=(deleter_ref&&) -> deleter_ref& = delete;
+
+        ~deleter_ref()
+        {
+            *this->was_deleted = true;
+        }
+    };
+
+    TEST_CASE("atomic::shared_ptr: copies on other threads keep the object alive")  // NOLINT
+    {
+        auto was_deleted = false;
+        auto ptr = wind::atomic::make_shared<deleter_ref>();
+        ptr->was_deleted = &was_deleted;
+        auto copies = std::vector<wind::atomic::shared_ptr<deleter_ref>>();
+
+        auto thread = std::thread(
+            [&ptr, &copies]()
+            {
+                copies.push_back(ptr);
+                copies.push_back(ptr);
+            });
+        thread.join();
+        CHECK(ptr.use_count() == 3);
+
+        ptr = wind::atomic::shared_ptr<deleter_ref>();
+        copies.pop_back();
+        CHECK_FALSE(was_deleted);
+        copies.pop_back();
+        CHECK(was_deleted);
+    }
+
+    TEST_CASE("atomic::shared_ptr: concurrent copies and releases free the object once")  // NOLINT
+    {
+        static auto alive = std::atomic<int> {0};
+        struct counted
+        {
+            counted() noexcept
+            {
+                alive++;
+            }
+            counted(const counted&) = delete;
+            counted(counted&&) = delete;
+            auto operator=(const counted&) -> counted& = delete;
+            auto operator=(counted&&) -> counted& = delete;
+            ~counted() noexcept
+            {
+                alive--;
+            }
+        };
+
+        auto locked = std::atomic<int> {0};
+        {
+            auto ptr = wind::atomic::make_shared<counted>();
+            auto threads = std::vector<std::thread>();
+            for (auto t = 0; t < 4; t++) {
+                threads.emplace_back(
+                    [ptr, &locked]()
+                    {
+                        for (auto i = 0; i < 1000; i++) {
+                            auto copy = ptr;
+                            auto weak = wind::atomic::weak_ptr<counted>(copy);
+                            if (weak.lock()) {
+                                locked++;
+                            }
+                        }
+                    });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            CHECK(ptr.use_count() == 1);
+        }
+        CHECK(locked == 4000);
+        CHECK(alive == 0);
+    }
+
+    TEST_CASE("atomic::weak_ptr: lock fails once the object is gone")  // NOLINT
+    {
+        auto was_deleted = false;
+        auto weak = wind::atomic::weak_ptr<deleter_ref>();
+        {
+            auto ptr = wind::atomic::make_shared<deleter_ref>();
+            ptr->was_deleted = &was_deleted;
+            weak = ptr;
+            CHECK(weak.lock().get() == ptr.get());
+            CHECK(weak.use_count() == 1);
+        }
+        CHECK(was_deleted);
+        CHECK(weak.expired());
+        CHECK_FALSE(weak.lock());
+    }
+
+    TEST_CASE("atomic::shared_ptr: make_shared of an array allocates it with the control block")  // NOLINT
+    {
+        auto ptr = wind::atomic::make_shared<int[]>(4, 7);  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        CHECK(ptr[0] == 7);
+        CHECK(ptr[3] == 7);
+        auto borrowed = wind::atomic::borrowed_ptr<int[]>(ptr);  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        CHECK(borrowed[3] == 7);
+        CHECK(borrowed.to_shared().use_count() == 2);
+    }
+
+    struct self_aware : wind::atomic::enable_shared_from_this<self_aware>
+    {
+        // not an aggregate, so make_shared does not initialize the protected base directly
+        self_aware() = default;
+    };
+
+    TEST_CASE("atomic::enable_shared_from_this: make_shared links the object to its owner")  // NOLINT
+    {
+        auto ptr = wind::atomic::make_shared<self_aware>();
+        auto self = ptr->shared_from_this();
+        CHECK(self.get() == ptr.get());
+        CHECK(ptr.use_count() == 2);
+    }
+
+    TEST_CASE("atomic::shared_ptr: copy_all and release_all count the copies of each object at once")  // NOLINT
+    {
+        // more objects than the batch sums up at a time
+        auto objects = std::vector<wind::atomic::shared_ptr<int>>();
+        for (auto i = 0; i < 40; i++) {
+            objects.push_back(wind::atomic::make_shared<int>(i));
+        }
+        auto ptrs = std::vector<wind::atomic::shared_ptr<int>>();
+        for (auto i = 0; i < 200; i++) {
+            ptrs.push_back(objects[static_cast<size_t>(i % 40)]);
+        }
+
+        auto copies = wind::copy_all(ptrs);
+        CHECK(copies.size() == ptrs.size());
+        CHECK(*copies[41] == 1);
+        CHECK(objects[0].use_count() == 11);
+
+        // not sized, so the copies are appended one by one
+        auto odd = wind::copy_all(ptrs | std::views::filter([](const auto& ptr) { return *ptr % 2 == 1; }));
+        CHECK(odd.size() == 100);
+        CHECK(objects[1].use_count() == 16);
+
+        wind::release_all(copies);
+        wind::release_all(odd);
+        CHECK_FALSE(copies[0]);
+        CHECK(objects[0].use_count() == 6);
+        CHECK(objects[1].use_count() == 6);
+
+        wind::release_all(ptrs);
+        for (const auto& object : objects) {
+            CHECK(object.unique());
+        }
+    }
+
+    TEST_CASE("atomic::shared_ptr: make_shared_n frees the allocation with the last object")  // NOLINT
+    {
+        auto kept = wind::atomic::shared_ptr<int>();
+        {
+            auto ptrs = wind::atomic::make_shared_n<int>(5, 3);
+            CHECK(*ptrs[4] == 3);
+            kept = ptrs[2];
+        }
+        auto thread = std::thread([&kept]() { kept = wind::atomic::shared_ptr<int>(); });
+        thread.join();
+        CHECK_FALSE(kept);
+    }
+}
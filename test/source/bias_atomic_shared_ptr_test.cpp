@@ -0,0 +1,276 @@
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <shared_ptr/bias_atomic_shared_ptr.hpp>
+
+TEST_SUITE("bias::atomic_shared_ptr")  // NOLINT
+{
+    // NOLINTNEXTLINE
+    struct counted
+    {
+        static inline std::atomic<int> alive {0};
+        int value;
+
+        explicit counted(int i_value)
+            : value(i_value)
+        {
+            alive++;
+        }
+        counted(const counted&) = delete;
+        counted(counted&&) = delete;
+        auto operator=(const counted&) -> counted& = delete;
+        auto operator=(counted&&) -> counted& = delete;
+        ~counted()
+        {
+            alive--;
+        }
+    };
+
+    TEST_CASE("bias::atomic_shared_ptr: default constructed loads nullptr")  // NOLINT
+    {
+        auto atomic = wind::bias::atomic_shared_ptr<int>();
+        CHECK(!atomic.load());
+        CHECK(atomic.is_lock_free());
+    }
+
+    TEST_CASE("bias::atomic_shared_ptr: load returns the stored value")  // NOLINT
+    {
+        {
+            auto atomic = wind::bias::atomic_shared_ptr<counted>(wind::bias::make_shared<counted>(1));
+            auto loaded = atomic.load();
+            CHECK(loaded->value == 1);
+
+            atomic.store(wind::bias::make_shared<counted>(2));
+            CHECK(atomic.load()->value == 2);
+            CHECK(loaded->value == 1);
+            CHECK(counted::alive == 2);
+        }
+        CHECK(counted::alive == 0);
+    }
+
+    TEST_CASE("bias::atomic_shared_ptr: exchange returns the previous value")  // NOLINT
+    {
+        {
+            auto atomic = wind::bias::atomic_shared_ptr<counted>(wind::bias::make_shared<counted>(1));
+            auto previous = atomic.exchange(wind::bias::make_shared<counted>(2));
+            CHECK(previous->value == 1);
+            CHECK(atomic.load()->value == 2);
+        }
+        CHECK(counted::alive == 0);
+    }
+
+    TEST_CASE("bias::atomic_shared_ptr: compare_exchange only replaces the expected value")  // NOLINT
+    {
+        {
+            auto first = wind::bias::make_shared<counted>(1);
+            auto atomic = wind::bias::atomic_shared_ptr<counted>(first);
+
+            auto expected = wind::bias::make_shared<counted>(3);
+            CHECK(!atomic.compare_exchange_strong(expected, wind::bias::make_shared<counted>(2)));
+            CHECK(expected.get() == first.get());
+
+            CHECK(atomic.compare_exchange_strong(expected, wind::bias::make_shared<counted>(2)));
+            CHECK(atomic.load()->value == 2);
+        }
+        CHECK(counted::alive == 0);
+    }
+
+    TEST_CASE("bias::atomic_shared_ptr: stores aliased pointers")  // NOLINT
+    {
+        struct pair_of_ints
+        {
+            int first;
+            int second;
+        };
+
+        auto pair = wind::bias::make_shared<pair_of_ints>(1, 2);
+        auto atomic = wind::bias::atomic_shared_ptr<int>(wind::bias::shared_ptr<int>(pair, &pair->second));
+        pair = wind::bias::shared_ptr<pair_of_ints>();
+
+        auto loaded = atomic.load();
+        CHECK(*loaded == 2);
+
+        auto expected = loaded;
+        CHECK(atomic.compare_exchange_strong(expected, wind::bias::shared_ptr<int>()));
+        CHECK(*loaded == 2);
+    }
+
+    TEST_CASE("bias::atomic_shared_ptr: compare_exchange matches the aliased pointer that was stored")  // NOLINT
+    {
+        {
+            auto pair = wind::bias::make_shared<std::pair<counted, counted>>(1, 2);
+            auto aliased = wind::bias::shared_ptr<counted>(pair, &pair->second);
+            auto atomic = wind::bias::atomic_shared_ptr<counted>(aliased);
+
+            auto other = wind::bias::shared_ptr<counted>(pair, &pair->first);
+            CHECK(!atomic.compare_exchange_strong(other, wind::bias::make_shared<counted>(3)));
+            CHECK(other->value == 2);
+
+            auto expected = aliased;
+            CHECK(atomic.compare_exchange_strong(expected, wind::bias::make_shared<counted>(3)));
+            CHECK(atomic.load()->value == 3);
+        }
+        CHECK(counted::alive == 0);
+    }
+
+    TEST_CASE("bias::atomic_shared_ptr: stores copies moved in from another thread")  // NOLINT
+    {
+        {
+            auto atomic = wind::bias::atomic_shared_ptr<counted>();
+            auto moved = wind::bias::shared_ptr<counted>();
+            std::thread([&moved]() { moved = wind::bias::make_shared<counted>(1); }).join();
+            std::thread([&atomic, &moved]() { atomic.store(std::move(moved)); }).join();
+            CHECK(atomic.load()->value == 1);
+        }
+        CHECK(counted::alive == 0);
+    }
+
+    TEST_CASE("bias::atomic_shared_ptr: stores stray copies while the thread's release is deferred")  // NOLINT
+    {
+        wind::bias::set_release_batch_size(8);
+        {
+            auto atomic = wind::bias::atomic_shared_ptr<counted>();
+            auto ptr = wind::bias::make_shared<counted>(1);
+            auto stray = wind::bias::shared_ptr<counted>();
+            std::thread([&ptr, &stray]() { stray = ptr; }).join();
+
+            // this thread's counter drops to zero, with its global reference still queued
+            ptr = wind::bias::shared_ptr<counted>();
+            atomic.store(std::move(stray));
+            wind::bias::flush();
+            CHECK(counted::alive == 1);
+        }
+        wind::bias::set_release_batch_size(0);
+        CHECK(counted::alive == 0);
+    }
+
+    TEST_CASE("bias::atomic_shared_ptr: concurrent loads and stores do not leak")  // NOLINT
+    {
+        {
+            auto atomic = wind::bias::atomic_shared_ptr<counted>(wind::bias::make_shared<counted>(0));
+            auto threads = std::vector<std::thread>();
+            for (auto t = 0; t < 4; t++) {
+                threads.emplace_back(
+                    [&atomic, t]()
+                    {
+                        for (auto i = 0; i < 2000; i++) {
+                            if (i % 8 == t) {
+                                atomic.store(wind::bias::make_shared<counted>(i));
+                            } else {
+                                auto loaded = atomic.load();
+                                CHECK(loaded->value >= 0);
+                            }
+                        }
+                    });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+        CHECK(counted::alive == 0);
+    }
+
+    TEST_CASE("bias::atomic_shared_ptr: a failed compare_exchange returns the value it compared with")  // NOLINT
+    {
+        constexpr auto increments = 1000;
+        {
+            auto atomic = wind::bias::atomic_shared_ptr<counted>(wind::bias::make_shared<counted>(0));
+            auto threads = std::vector<std::thread>();
+            for (auto t = 0; t < 4; t++) {
+                threads.emplace_back(
+                    [&atomic]()
+                    {
+                        auto expected = atomic.load();
+                        for (auto i = 0; i < increments; i++) {
+                            // every retry starts from the value the failed attempt saw, so no increment is lost
+                            while (!atomic.compare_exchange_weak(expected,
+                                                                 wind::bias::make_shared<counted>(expected->value + 1)))
+                            {
+                            }
+                            expected = atomic.load();
+                        }
+                    });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            CHECK(atomic.load()->value == 4 * increments);
+        }
+        wind::epoch::reclaim();
+        CHECK(counted::alive == 0);
+    }
+
+    TEST_CASE("bias::atomic_shared_ptr: snapshots read the stored value without a reference")  // NOLINT
+    {
+        {
+            auto atomic = wind::bias::atomic_shared_ptr<counted>(wind::bias::make_shared<counted>(1));
+            auto guard = wind::epoch::guard();
+            auto snapshot = atomic.load(guard);
+            CHECK(snapshot->value == 1);
+            CHECK(snapshot.get() == atomic.load().get());
+        }
+        wind::epoch::reclaim();
+        CHECK(counted::alive == 0);
+    }
+
+    TEST_CASE("bias::atomic_shared_ptr: replaced values live until the guard is left")  // NOLINT
+    {
+        auto atomic = wind::bias::atomic_shared_ptr<counted>(wind::bias::make_shared<counted>(1));
+        {
+            auto guard = wind::epoch::guard();
+            auto snapshot = atomic.load(guard);
+            atomic.store(wind::bias::make_shared<counted>(2));
+            wind::epoch::reclaim();
+            CHECK(snapshot->value == 1);
+            CHECK(counted::alive == 2);
+        }
+        wind::epoch::reclaim();
+        CHECK(counted::alive == 1);
+        atomic.store(wind::bias::shared_ptr<counted>());
+        CHECK(counted::alive == 0);
+    }
+
+    TEST_CASE("bias::atomic_shared_ptr: shared snapshots outlive the guard")  // NOLINT
+    {
+        auto shared = wind::bias::shared_ptr<counted>();
+        {
+            auto atomic = wind::bias::atomic_shared_ptr<counted>(wind::bias::make_shared<counted>(1));
+            auto guard = wind::epoch::guard();
+            shared = atomic.load(guard).share();
+        }
+        wind::epoch::reclaim();
+        CHECK(shared->value == 1);
+        shared = wind::bias::shared_ptr<counted>();
+        CHECK(counted::alive == 0);
+    }
+
+    TEST_CASE("bias::atomic_shared_ptr: concurrent snapshots and stores do not leak")  // NOLINT
+    {
+        {
+            auto atomic = wind::bias::atomic_shared_ptr<counted>(wind::bias::make_shared<counted>(0));
+            auto threads = std::vector<std::thread>();
+            for (auto t = 0; t < 4; t++) {
+                threads.emplace_back(
+                    [&atomic, t]()
+                    {
+                        for (auto i = 0; i < 2000; i++) {
+                            if (i % 8 == t) {
+                                atomic.store(wind::bias::make_shared<counted>(i));
+                            } else {
+                                auto guard = wind::epoch::guard();
+                                CHECK(atomic.load(guard)->value >= 0);
+                            }
+                        }
+                    });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+        wind::epoch::reclaim();
+        CHECK(counted::alive == 0);
+    }
+}
@@ -1,4 +1,9 @@
-
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <stdexcept>
 #include <thread>
 #include <vector>
 
@@ -215,4 +220,691 @@ TEST_SUITE("bias::shared_ptr")  // NOLINT
         ptrs.push_back(ptr);
         CHECK(ptrs.size() == number_of_push_backs_until_resize);
     }
-}
\ No newline at end of file
+
+    TEST_CASE("bias::shared_ptr_3: copies on another thread do not mix up counters")  // NOLINT
+    {
+        auto first_deleted = false;
+        auto second_deleted = false;
+        auto first = wind::bias::make_shared<deleter_ref>();
+        first->was_deleted = &first_deleted;
+
+        auto thread = std::thread(
+            [&first, &second_deleted]()
+            {
+                auto second = wind::bias::make_shared<deleter_ref>();
+                second->was_deleted = &second_deleted;
+                {
+                    auto first_copy = first;  // NOLINT
+                    auto second_copy = second;  // NOLINT
+                }
+                CHECK(!second_deleted);
+            });
+        thread.join();
+
+        CHECK(second_deleted);
+        CHECK(!first_deleted);
+        first = wind::bias::shared_ptr<deleter_ref>();
+        CHECK(first_deleted);
+    }
+
+    struct pair_of_ints  // NOLINT
+    {
+        int first;
+        int second;
+    };
+
+    TEST_CASE("bias::shared_ptr_3: aliasing constructor shares ownership")  // NOLINT
+    {
+        auto pair = wind::bias::make_shared<pair_of_ints>(1, 2);
+        auto second = wind::bias::shared_ptr<int>(pair, &pair->second);
+        CHECK(*second == 2);
+
+        pair = wind::bias::shared_ptr<pair_of_ints>();
+        CHECK(*second == 2);
+        CHECK(second.unique());
+    }
+
+    TEST_CASE("bias::shared_ptr_3: aliasing copies on another thread keep the owner alive")  // NOLINT
+    {
+        auto was_deleted = false;
+        auto owner = wind::bias::make_shared<deleter_ref>();
+        owner->was_deleted = &was_deleted;
+        auto alias = wind::bias::shared_ptr<bool*>(owner, &owner->was_deleted);
+
+        auto thread = std::thread(
+            [&alias]()
+            {
+                auto copy = alias;
+                CHECK(!**copy);
+            });
+        thread.join();
+
+        owner = wind::bias::shared_ptr<deleter_ref>();
+        CHECK(!was_deleted);
+        alias = wind::bias::shared_ptr<bool*>();
+        CHECK(was_deleted);
+    }
+
+    TEST_CASE("bias::shared_ptr_3: swap exchanges pointers")  // NOLINT
+    {
+        auto first = wind::bias::make_shared<int>(1);
+        auto second = wind::bias::make_shared<int>(2);
+        first.swap(second);
+        CHECK(*first == 2);
+        CHECK(*second == 1);
+    }
+
+    TEST_CASE("bias::weak_ptr: lock returns the object while it is alive")  // NOLINT
+    {
+        auto ptr = wind::bias::make_shared<int>(42);
+        auto weak = wind::bias::weak_ptr<int>(ptr);
+        CHECK(!weak.expired());
+
+        auto locked = weak.lock();
+        CHECK(*locked == 42);
+        CHECK(ptr.use_count() == 1);
+    }
+
+    TEST_CASE("bias::weak_ptr: object is destroyed while weak_ptrs remain")  // NOLINT
+    {
+        auto was_deleted = false;
+        auto weak = wind::bias::weak_ptr<deleter_ref>();
+        {
+            auto ptr = wind::bias::make_shared<deleter_ref>();
+            ptr->was_deleted = &was_deleted;
+            weak = ptr;
+            auto locked = weak.lock();
+            CHECK(!was_deleted);
+        }
+        CHECK(was_deleted);
+        CHECK(weak.expired());
+        CHECK(!weak.lock());
+    }
+
+    TEST_CASE("bias::shared_ptr: the last copy released on another thread is handed back to the creator")  // NOLINT
+    {
+        auto was_deleted = false;
+        auto weak = wind::bias::weak_ptr<deleter_ref>();
+        {
+            auto ptr = wind::bias::make_shared<deleter_ref>();
+            ptr->was_deleted = &was_deleted;
+            weak = ptr;
+            std::thread([moved = std::move(ptr)]() mutable { moved = wind::bias::shared_ptr<deleter_ref>(); }).join();
+        }
+        CHECK(!was_deleted);
+
+        // the creating thread is still alive and reconciles the release the next time it allocates
+        auto next = wind::bias::make_shared<int>(1);
+        CHECK(was_deleted);
+        CHECK(weak.expired());
+        CHECK(!weak.lock());
+    }
+
+    TEST_CASE("bias::weak_ptr: lock on another thread registers that thread")  // NOLINT
+    {
+        auto was_deleted = false;
+        auto ptr = wind::bias::make_shared<deleter_ref>();
+        ptr->was_deleted = &was_deleted;
+        auto weak = wind::bias::weak_ptr<deleter_ref>(ptr);
+
+        auto thread = std::thread(
+            [&weak, &ptr]()
+            {
+                auto locked = weak.lock();
+                CHECK(locked);
+                CHECK(ptr.use_count() == 2);
+            });
+        thread.join();
+
+        CHECK(ptr.use_count() == 1);
+        ptr = wind::bias::shared_ptr<deleter_ref>();
+        CHECK(was_deleted);
+        CHECK(!weak.lock());
+    }
+
+    template<typename T>
+    struct counting_allocator
+    {
+        using value_type = T;
+
+        int* allocations;
+
+        explicit counting_allocator(int* i_allocations) noexcept
+            : allocations(i_allocations)
+        {
+        }
+
+        template<typename U>
+        counting_allocator(const counting_allocator<U>& other) noexcept  // NOLINT(google-explicit-constructor)
+            : allocations(other.allocations)
+        {
+        }
+
+        auto allocate(size_t n) -> T*
+        {
+            (*this->allocations)++;
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* ptr, size_t n) noexcept
+        {
+            (*this->allocations)--;
+            std::allocator<T>().deallocate(ptr, n);
+        }
+
+        template<typename U>
+        auto operator==(const counting_allocator<U>& other) const noexcept -> bool
+        {
+            return this->allocations == other.allocations;
+        }
+    };
+
+    TEST_CASE("bias::shared_ptr: allocate_shared allocates and frees through the allocator")  // NOLINT
+    {
+        int allocations = 0;
+        {
+            auto ptr = wind::bias::allocate_shared<int>(counting_allocator<int>(&allocations), 42);
+            auto copy = ptr;
+            CHECK(*copy == 42);
+            CHECK(allocations == 1);
+        }
+        CHECK(allocations == 0);
+    }
+
+    TEST_CASE("bias::shared_ptr: allocate_shared keeps the block allocated for weak_ptrs")  // NOLINT
+    {
+        int allocations = 0;
+        auto was_deleted = false;
+        auto weak = wind::bias::weak_ptr<deleter_ref>();
+        {
+            auto ptr = wind::bias::allocate_shared<deleter_ref>(counting_allocator<int>(&allocations));
+            ptr->was_deleted = &was_deleted;
+            weak = ptr;
+        }
+        CHECK(was_deleted);
+        CHECK(allocations == 1);
+        weak.reset();
+        CHECK(allocations == 0);
+    }
+
+    TEST_CASE("bias::shared_ptr: allocate_shared works with polymorphic allocators")  // NOLINT
+    {
+        auto buffer = std::array<std::byte, 1024>();
+        auto resource = std::pmr::monotonic_buffer_resource(buffer.data(), buffer.size());
+        auto ptr = wind::bias::allocate_shared<int>(std::pmr::polymorphic_allocator<int>(&resource), 42);
+        auto* address = reinterpret_cast<std::byte*>(ptr.get());  // NOLINT
+        CHECK(*ptr == 42);
+        CHECK(address >= buffer.data());
+        CHECK(address < buffer.data() + buffer.size());  // NOLINT
+    }
+
+    TEST_CASE("bias::shared_ptr: deferred releases are applied on flush")  // NOLINT
+    {
+        wind::bias::set_release_batch_size(8);
+        auto was_deleted = false;
+        {
+            auto ptr = wind::bias::make_shared<deleter_ref>();
+            ptr->was_deleted = &was_deleted;
+        }
+        CHECK(!was_deleted);
+        wind::bias::flush();
+        CHECK(was_deleted);
+        wind::bias::set_release_batch_size(0);
+    }
+
+    TEST_CASE("bias::shared_ptr: deferred releases are applied at the batch size")  // NOLINT
+    {
+        wind::bias::set_release_batch_size(2);
+        auto first_deleted = false;
+        auto second_deleted = false;
+        {
+            auto first = wind::bias::make_shared<deleter_ref>();
+            first->was_deleted = &first_deleted;
+        }
+        CHECK(!first_deleted);
+        {
+            auto second = wind::bias::make_shared<deleter_ref>();
+            second->was_deleted = &second_deleted;
+        }
+        CHECK(first_deleted);
+        CHECK(second_deleted);
+        wind::bias::set_release_batch_size(0);
+    }
+
+    TEST_CASE("bias::shared_ptr: copies taken again before a flush are not released")  // NOLINT
+    {
+        wind::bias::set_release_batch_size(8);
+        auto was_deleted = false;
+        auto weak = wind::bias::weak_ptr<deleter_ref>();
+        {
+            auto ptr = wind::bias::make_shared<deleter_ref>();
+            ptr->was_deleted = &was_deleted;
+            weak = ptr;
+        }
+        {
+            auto locked = weak.lock();
+            CHECK(locked.use_count() == 1);
+        }
+        auto locked = weak.lock();
+        wind::bias::flush();
+        CHECK(!was_deleted);
+        CHECK(locked.use_count() == 1);
+
+        locked = wind::bias::shared_ptr<deleter_ref>();
+        wind::bias::flush();
+        CHECK(was_deleted);
+        wind::bias::set_release_batch_size(0);
+    }
+
+    TEST_CASE("bias::shared_ptr: deferred releases are applied at thread exit")  // NOLINT
+    {
+        auto was_deleted = false;
+        auto ptr = wind::bias::make_shared<deleter_ref>();
+        ptr->was_deleted = &was_deleted;
+
+        auto thread = std::thread(
+            [&ptr]()
+            {
+                wind::bias::set_release_batch_size(8);
+                auto copy = wind::bias::shared_ptr<deleter_ref>();
+                copy = ptr;
+                CHECK(ptr.use_count() == 2);
+            });
+        thread.join();
+        CHECK(ptr.use_count() == 1);
+        ptr = wind::bias::shared_ptr<deleter_ref>();
+        CHECK(was_deleted);
+    }
+
+    TEST_CASE("bias::shared_ptr: copies left behind by an exited thread are freed elsewhere")  // NOLINT
+    {
+        auto was_deleted = false;
+        auto copies = std::vector<wind::bias::shared_ptr<deleter_ref>>();
+
+        auto thread = std::thread(
+            [&copies, &was_deleted]()
+            {
+                auto ptr = wind::bias::make_shared<deleter_ref>();
+                ptr->was_deleted = &was_deleted;
+                copies.push_back(ptr);
+                copies.push_back(ptr);
+            });
+        thread.join();
+        CHECK_FALSE(was_deleted);
+        CHECK(copies[0].use_count() == 0);
+
+        copies.pop_back();
+        CHECK_FALSE(was_deleted);
+        copies.pop_back();
+        CHECK(was_deleted);
+    }
+
+    struct alive_counter
+    {
+        static inline std::atomic<int> alive {0};
+
+        alive_counter() noexcept
+        {
+            alive++;
+        }
+
+        alive_counter(const alive_counter&) = delete;
+        alive_counter(alive_counter&&) = delete;
+        auto operator=(const alive_counter&) -> alive_counter& = delete;
+        auto operator=(alive_counter&&) -> alive_counter& = delete;
+
+        ~alive_counter() noexcept
+        {
+            alive--;
+        }
+    };
+
+    TEST_CASE("bias::shared_ptr: flush reconciles copies released on other threads")  // NOLINT
+    {
+        constexpr auto objects = 1000;
+
+        auto weaks = std::vector<wind::bias::weak_ptr<alive_counter>>();
+        auto handed_over = std::vector<wind::bias::shared_ptr<alive_counter>>();
+        for (auto i = 0; i < objects; i++) {
+            handed_over.push_back(wind::bias::make_shared<alive_counter>());
+            weaks.emplace_back(handed_over.back());
+        }
+        auto copies = handed_over;
+        handed_over.clear();
+        CHECK(alive_counter::alive == objects);
+
+        std::thread([&copies]() { copies.clear(); }).join();
+        wind::bias::flush();
+        CHECK(alive_counter::alive == 0);
+        for (const auto& weak : weaks) {
+            CHECK(weak.expired());
+        }
+    }
+
+    TEST_CASE("bias::shared_ptr: objects stay bounded while thousands of threads come and go")  // NOLINT
+    {
+        constexpr auto rounds = 250;
+        constexpr auto threads_per_round = 8;
+
+        auto mutex = std::mutex();
+        auto shared = wind::bias::make_shared<alive_counter>();
+        for (auto round = 0; round < rounds; round++) {
+            auto handed_over = std::vector<wind::bias::shared_ptr<alive_counter>>();
+            auto threads = std::vector<std::thread>();
+            for (auto i = 0; i < threads_per_round; i++) {
+                threads.emplace_back(
+                    [&]()
+                    {
+                        auto own = wind::bias::make_shared<alive_counter>();
+                        auto lock = std::lock_guard(mutex);
+                        auto copy = shared;
+                        handed_over.push_back(copy);
+                        handed_over.push_back(own);
+                        // the replaced object may have been created and copied on other threads
+                        shared = own;
+                    });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            // the handed over copies and the one in shared
+            CHECK(alive_counter::alive.load() <= threads_per_round + 2);
+        }
+        shared = wind::bias::shared_ptr<alive_counter>();
+        CHECK(alive_counter::alive.load() == 0);
+    }
+
+    auto read_through(wind::bias::borrowed_ptr<int> borrowed, int depth) -> int
+    {
+        if (depth == 0) {
+            return *borrowed;
+        }
+        return read_through(borrowed, depth - 1);
+    }
+
+    TEST_CASE("bias::borrowed_ptr: borrowing does not count references")  // NOLINT
+    {
+        auto ptr = wind::bias::make_shared<int>(42);
+        CHECK(read_through(ptr, 8) == 42);
+        auto borrowed = wind::bias::borrowed_ptr<int>(ptr);
+        CHECK(borrowed.get() == ptr.get());
+        CHECK(ptr.use_count() == 1);
+        CHECK(!wind::bias::borrowed_ptr<int>());
+    }
+
+    TEST_CASE("bias::borrowed_ptr: to_shared takes an owning copy")  // NOLINT
+    {
+        auto owner = wind::bias::make_shared<int>(42);
+        auto borrowed = wind::bias::borrowed_ptr<int>(owner);
+        auto copy = borrowed.to_shared();
+        CHECK(copy.get() == owner.get());
+        owner = wind::bias::shared_ptr<int>();
+        CHECK(*copy == 42);
+        CHECK(!wind::bias::borrowed_ptr<int>().to_shared());
+    }
+
+    TEST_CASE("bias::borrowed_ptr: to_shared on another thread counts that thread")  // NOLINT
+    {
+        auto owner = wind::bias::make_shared<int>(42);
+        auto borrowed = wind::bias::borrowed_ptr<int>(owner);
+        auto thread = std::thread(
+            [borrowed, &owner]()
+            {
+                auto copy = borrowed.to_shared();
+                CHECK(*copy == 42);
+                CHECK(owner.use_count() == 2);
+            });
+        thread.join();
+        CHECK(owner.use_count() == 1);
+    }
+
+    TEST_CASE("bias::shared_ptr: make_shared of an unbounded array value-initializes its elements")  // NOLINT
+    {
+        auto ptr = wind::bias::make_shared<int[]>(16);  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        for (auto i = 0; i < 16; i++) {
+            CHECK(ptr[i] == 0);
+            ptr[i] = i;
+        }
+        auto copy = ptr;
+        CHECK(copy[15] == 15);
+
+        auto filled = wind::bias::make_shared<int[]>(4, 7);  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        CHECK(filled[0] == 7);
+        CHECK(filled[3] == 7);
+    }
+
+    TEST_CASE("bias::shared_ptr: a make_shared that throws leaves no counter behind")  // NOLINT
+    {
+        struct throwing_copy
+        {
+            throwing_copy() = default;
+            throwing_copy(const throwing_copy& /*other*/)
+            {
+                throw std::runtime_error("copy");
+            }
+            throwing_copy(throwing_copy&&) = delete;
+            auto operator=(const throwing_copy&) -> throwing_copy& = delete;
+            auto operator=(throwing_copy&&) -> throwing_copy& = delete;
+            ~throwing_copy() = default;
+        };
+
+        // the thread exits right after, which would release a counter left behind for the failed block
+        std::thread(
+            []()
+            {
+                auto ptr = wind::bias::make_shared<int>(42);
+                CHECK_THROWS_AS(wind::bias::make_shared<throwing_copy[]>(4, throwing_copy()),  // NOLINT
+                                std::runtime_error);
+                CHECK(ptr.use_count() == 1);
+            })
+            .join();
+    }
+
+    TEST_CASE("bias::shared_ptr: make_shared of a bounded array destroys every element")  // NOLINT
+    {
+        struct counted
+        {
+            int* destroyed;
+            explicit counted(int* i_destroyed)
+                : destroyed(i_destroyed)
+            {
+            }
+            counted(const counted&) = default;
+            counted(counted&&) = delete;
+            auto operator=(const counted&) -> counted& = delete;
+            auto operator=(counted&&) -> counted& = delete;
+            ~counted()
+            {
+                (*this->destroyed)++;
+            }
+        };
+
+        auto destroyed = 0;
+        {
+            auto ptr = wind::bias::make_shared<counted[3]>(counted(&destroyed));  // NOLINT
+            destroyed = 0;
+            CHECK(ptr[2].destroyed == &destroyed);
+        }
+        CHECK(destroyed == 3);
+    }
+
+    TEST_CASE("bias::shared_ptr: array elements respect their alignment")  // NOLINT
+    {
+        struct alignas(64) aligned
+        {
+            char value;
+        };
+
+        auto ptr = wind::bias::make_shared<aligned[]>(3);  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        for (auto i = 0; i < 3; i++) {
+            CHECK(reinterpret_cast<std::uintptr_t>(&ptr[i]) % 64 == 0);  // NOLINT
+        }
+    }
+
+    TEST_CASE("bias::shared_ptr: arrays taken over from new[] are deleted with delete[]")  // NOLINT
+    {
+        auto ptr = wind::bias::shared_ptr<int[]>(new int[4] {1, 2, 3, 4});  // NOLINT
+        CHECK(ptr[3] == 4);
+    }
+
+    struct self_aware : wind::bias::enable_shared_from_this<self_aware>
+    {
+        // not an aggregate, so make_shared does not initialize the protected base directly
+        self_aware() = default;
+
+        int value = 42;
+    };
+
+    TEST_CASE("bias::enable_shared_from_this: make_shared links the object to its owner")  // NOLINT
+    {
+        auto ptr = wind::bias::make_shared<self_aware>();
+        auto self = ptr->shared_from_this();
+        CHECK(self.get() == ptr.get());
+        ptr = wind::bias::shared_ptr<self_aware>();
+        CHECK(self->value == 42);
+        CHECK(!self->weak_from_this().expired());
+    }
+
+    TEST_CASE("bias::enable_shared_from_this: taking over a raw pointer links it")  // NOLINT
+    {
+        auto ptr = wind::bias::shared_ptr<self_aware>(new self_aware());  // NOLINT(cppcoreguidelines-owning-memory)
+        const auto& constant = *ptr;
+        auto self = constant.shared_from_this();
+        CHECK(self.get() == ptr.get());
+    }
+
+    TEST_CASE("bias::enable_shared_from_this: unowned objects throw bad_weak_ptr")  // NOLINT
+    {
+        auto object = self_aware();
+        CHECK_THROWS_AS(static_cast<void>(object.shared_from_this()), std::bad_weak_ptr);
+        CHECK(object.weak_from_this().expired());
+
+        auto owned = wind::bias::make_shared<self_aware>(object);
+        CHECK(owned->shared_from_this().get() == owned.get());
+        CHECK_THROWS_AS(static_cast<void>(object.shared_from_this()), std::bad_weak_ptr);
+    }
+
+    TEST_CASE("bias::enable_shared_from_this: works on threads without copies")  // NOLINT
+    {
+        auto ptr = wind::bias::make_shared<self_aware>();
+        auto thread = std::thread(
+            [raw = ptr.get(), &ptr]()
+            {
+                auto copy = raw->shared_from_this();
+                auto again = raw->shared_from_this();
+                CHECK(copy.get() == raw);
+                CHECK(ptr.use_count() == 2);
+            });
+        thread.join();
+        CHECK(ptr.use_count() == 1);
+    }
+
+    TEST_CASE("bias::shared_ptr: make_shared_n gives objects with their own counts")  // NOLINT
+    {
+        auto alive_before = alive_counter::alive.load();
+        auto kept = wind::bias::shared_ptr<alive_counter>();
+        auto thread = std::thread(
+            [&kept, alive_before]()
+            {
+                auto ptrs = wind::bias::make_shared_n<alive_counter>(8);
+                CHECK(alive_counter::alive == alive_before + 8);
+                kept = ptrs[3];
+            });
+        thread.join();
+        CHECK(alive_counter::alive == alive_before + 1);
+
+        // the last block of the batch is released on another thread than it was made on, which frees the allocation
+        kept = wind::bias::shared_ptr<alive_counter>();
+        CHECK(alive_counter::alive == alive_before);
+        CHECK(wind::bias::make_shared_n<alive_counter>(0).empty());
+    }
+
+    TEST_CASE("bias::shared_ptr: copy_all and release_all count a range on this thread")  // NOLINT
+    {
+        auto first = wind::bias::make_shared<int>(1);
+        auto second = wind::bias::make_shared<int>(2);
+        auto ptrs = std::vector {first, second, first, wind::bias::shared_ptr<int>(), first};
+
+        auto copies = wind::copy_all(ptrs);
+        CHECK(copies.size() == ptrs.size());
+        CHECK(copies[0].get() == first.get());
+        CHECK(*copies[1] == 2);
+        CHECK_FALSE(copies[3]);
+
+        wind::release_all(copies);
+        CHECK_FALSE(copies[0]);
+        wind::release_all(ptrs);
+        CHECK(first.unique());
+        CHECK(second.unique());
+    }
+
+    TEST_CASE("bias::shared_ptr: release_all drops copies counted on other threads")  // NOLINT
+    {
+        auto was_deleted = false;
+        auto ptr = wind::bias::make_shared<deleter_ref>();
+        ptr->was_deleted = &was_deleted;
+        auto ptrs = std::vector<wind::bias::shared_ptr<deleter_ref>>(3, ptr);
+
+        // counted on the thread, which leaves them behind when it exits
+        auto copies = std::vector<wind::bias::shared_ptr<deleter_ref>>();
+        auto thread = std::thread([&ptrs, &copies]() { copies = wind::copy_all(ptrs); });
+        thread.join();
+        wind::release_all(ptrs);
+        copies.push_back(std::move(ptr));
+
+        // one copy counted by this thread and three stray ones
+        wind::release_all(copies);
+        CHECK(was_deleted);
+    }
+
+    TEST_CASE("bias::shared_ptr: statistics count the hot path when kept")  // NOLINT
+    {
+        auto before = wind::bias::read_statistics();
+        {
+            auto ptr = wind::bias::make_shared<int>(1);
+            auto copy = ptr;
+            auto thread = std::thread([&ptr]() { auto other = ptr; });
+            thread.join();
+        }
+        auto counted = wind::bias::read_statistics() - before;
+
+        if constexpr (wind::bias::detail::keep_statistics) {
+            CHECK(counted.keys_created == 1);
+            CHECK(counted.control_blocks_destroyed == 1);
+            // the copy and both releases on this thread, the copy and release on the other one misses then hits
+            CHECK(counted.local_hits == 4);
+            CHECK(counted.local_misses == 1);
+            CHECK(counted.global_increments == 1);
+            CHECK(counted.global_decrements == 2);
+            CHECK(counted.keys_returned == 2);
+        } else {
+            CHECK(counted.local_hits == 0);
+            CHECK(counted.local_misses == 0);
+            CHECK(counted.global_increments == 0);
+            CHECK(counted.control_blocks_destroyed == 0);
+        }
+    }
+
+    TEST_CASE("bias::shared_ptr: statistics of exited threads are kept without their counters")  // NOLINT
+    {
+        if constexpr (wind::bias::detail::keep_statistics) {
+            auto before = wind::bias::read_statistics();
+            auto& registry = wind::bias::detail::all_statistics();
+            auto registered = [&registry]()
+            {
+                auto lock = std::lock_guard(registry.mutex);
+                return registry.threads.size();
+            };
+            auto running = registered();
+
+            for (auto i = 0; i < 8; i++) {
+                std::thread([]() { auto ptr = wind::bias::make_shared<int>(1); }).join();
+            }
+
+            CHECK(registered() == running);
+            auto counted = wind::bias::read_statistics() - before;
+            CHECK(counted.keys_created == 8);
+            CHECK(counted.control_blocks_destroyed == 8);
+        }
+    }
+}
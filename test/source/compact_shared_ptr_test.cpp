@@ -0,0 +1,74 @@
+#include <cstdint>
+#include <memory>
+
+#include <doctest/doctest.h>
+#include <shared_ptr/compact_shared_ptr.hpp>
+
+TEST_SUITE("compact::shared_ptr")  // NOLINT
+{
+    TEST_CASE("compact::shared_ptr: make_shared works")  // NOLINT
+    {
+        auto my_shared = wind::compact::make_shared<int>(42);
+        CHECK(*my_shared == 42);
+        CHECK(my_shared.use_count() == 1);
+        CHECK(my_shared.unique());
+    }
+
+    TEST_CASE("compact::shared_ptr: copies count references")  // NOLINT
+    {
+        auto my_shared = wind::compact::make_shared<int>(42);
+        auto copy = my_shared;
+        CHECK(*copy == 42);
+        CHECK(my_shared.use_count() == 2);
+        auto moved = std::move(copy);
+        CHECK(my_shared.use_count() == 2);
+        CHECK_FALSE(my_shared.unique());
+    }
+
+    TEST_CASE("compact::shared_ptr: control blocks are packed")  // NOLINT
+    {
+        using control_block = wind::compact::detail::control_block;
+        CHECK(sizeof(control_block) == 16);
+        CHECK(sizeof(wind::detail::control_block_with_data<control_block, int64_t>) == 24);
+        // the stateless default deleter takes no space next to the data pointer
+        CHECK(sizeof(wind::detail::control_block_with_deleter<control_block, int64_t, std::default_delete<int64_t>>)
+              == 24);
+    }
+
+    TEST_CASE("compact::shared_ptr: a raw pointer is deleted with the last copy")  // NOLINT
+    {
+        auto was_deleted = false;
+        {
+            auto ptr = wind::compact::shared_ptr<int>(new int(42),  // NOLINT(cppcoreguidelines-owning-memory)
+                                                      [&was_deleted](const int* data)
+                                                      {
+                                                          was_deleted = true;
+                                                          delete data;  // NOLINT(cppcoreguidelines-owning-memory)
+                                                      });
+            auto copy = ptr;
+            ptr = wind::compact::shared_ptr<int>();
+            CHECK_FALSE(was_deleted);
+        }
+        CHECK(was_deleted);
+    }
+
+    TEST_CASE("compact::weak_ptr: lock fails once the object is gone")  // NOLINT
+    {
+        auto weak = wind::compact::weak_ptr<int>();
+        {
+            auto ptr = wind::compact::make_shared<int>(42);
+            weak = ptr;
+            CHECK(weak.lock().get() == ptr.get());
+            CHECK(weak.use_count() == 1);
+        }
+        CHECK(weak.expired());
+        CHECK_FALSE(weak.lock());
+    }
+
+    TEST_CASE("compact::shared_ptr: make_shared of an array allocates it with the control block")  // NOLINT
+    {
+        auto ptr = wind::compact::make_shared<int[]>(4, 7);  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        CHECK(ptr[0] == 7);
+        CHECK(ptr[3] == 7);
+    }
+}
@@ -0,0 +1,89 @@
+#include <thread>
+
+#include <doctest/doctest.h>
+#include <shared_ptr/epoch.hpp>
+
+TEST_SUITE("epoch")  // NOLINT
+{
+    void count_release(void* released) noexcept
+    {
+        (*static_cast<int*>(released))++;
+    }
+
+    TEST_CASE("epoch: retiring without active guards releases right away")  // NOLINT
+    {
+        auto releases = 0;
+        wind::epoch::retire(&releases, count_release);
+        CHECK(releases == 1);
+    }
+
+    TEST_CASE("epoch: retired objects wait for the active guard")  // NOLINT
+    {
+        auto releases = 0;
+        {
+            auto guard = wind::epoch::guard();
+            wind::epoch::retire(&releases, count_release);
+            wind::epoch::reclaim();
+            CHECK(releases == 0);
+        }
+        wind::epoch::reclaim();
+        CHECK(releases == 1);
+    }
+
+    TEST_CASE("epoch: nested guards keep the outer one active")  // NOLINT
+    {
+        auto releases = 0;
+        {
+            auto outer = wind::epoch::guard();
+            {
+                auto inner = wind::epoch::guard();
+            }
+            wind::epoch::retire(&releases, count_release);
+            wind::epoch::reclaim();
+            CHECK(releases == 0);
+        }
+        wind::epoch::reclaim();
+        CHECK(releases == 1);
+    }
+
+    TEST_CASE("epoch: guards on other threads hold back releases")  // NOLINT
+    {
+        auto releases = 0;
+        auto entered = std::atomic<bool> {false};
+        auto leave = std::atomic<bool> {false};
+        auto reader = std::thread(
+            [&]()
+            {
+                auto guard = wind::epoch::guard();
+                entered = true;
+                while (!leave) {
+                    std::this_thread::yield();
+                }
+            });
+        while (!entered) {
+            std::this_thread::yield();
+        }
+
+        wind::epoch::retire(&releases, count_release);
+        wind::epoch::reclaim();
+        CHECK(releases == 0);
+
+        leave = true;
+        reader.join();
+        wind::epoch::reclaim();
+        CHECK(releases == 1);
+    }
+
+    TEST_CASE("epoch: objects retired by exited threads are reclaimed")  // NOLINT
+    {
+        auto releases = 0;
+        {
+            auto guard = wind::epoch::guard();
+            auto thread = std::thread([&releases]() { wind::epoch::retire(&releases, count_release); });
+            thread.join();
+            CHECK(releases == 0);
+        }
+        wind::epoch::reclaim();
+        CHECK(releases == 1);
+    }
+}
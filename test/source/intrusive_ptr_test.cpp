@@ -0,0 +1,228 @@
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <shared_ptr/intrusive_ptr.hpp>
+
+TEST_SUITE("intrusive_ptr")  // NOLINT
+{
+    template<template<typename> typename CountedT>
+    struct tracked : CountedT<tracked<CountedT>>
+    {
+        int value {0};
+        bool* was_deleted {nullptr};
+
+        tracked() = default;
+
+        tracked(int initial_value, bool* deleted_flag)
+            : value(initial_value)
+            , was_deleted(deleted_flag)
+        {
+        }
+
+        tracked(const tracked&) = default;
+        tracked(tracked&&) = delete;
+        auto operator=(const tracked&) -> tracked& = default;
+        auto operator=(tracked&&) -> tracked& = delete;
+
+        virtual ~tracked()
+        {
+            if (this->was_deleted != nullptr) {
+                *this->was_deleted = true;
+            }
+        }
+    };
+
+    template<template<typename> typename CountedT>
+    struct derived_tracked : tracked<CountedT>
+    {
+        derived_tracked(int initial_value, bool* deleted_flag)
+            : tracked<CountedT>(initial_value, deleted_flag)
+        {
+        }
+    };
+
+    template<template<typename> typename CountedT>
+    void check_make_intrusive()
+    {
+        auto was_deleted = false;
+        auto ptr = wind::make_intrusive<tracked<CountedT>>(42, &was_deleted);
+        CHECK(ptr->value == 42);
+        CHECK((*ptr).value == 42);
+        CHECK(ptr.use_count() == 1);
+        ptr = wind::intrusive_ptr<tracked<CountedT>>();
+        CHECK(was_deleted);
+        CHECK(ptr.use_count() == 0);
+        CHECK_FALSE(ptr);
+    }
+
+    TEST_CASE("intrusive_ptr: make_intrusive works")  // NOLINT
+    {
+        check_make_intrusive<wind::local_counted>();
+        check_make_intrusive<wind::atomic_counted>();
+        check_make_intrusive<wind::bias_counted>();
+    }
+
+    template<template<typename> typename CountedT>
+    void check_copies_keep_alive()
+    {
+        auto was_deleted = false;
+        auto copy = wind::intrusive_ptr<tracked<CountedT>>();
+        {
+            auto ptr = wind::make_intrusive<tracked<CountedT>>(42, &was_deleted);
+            copy = ptr;
+            auto moved = std::move(ptr);
+            CHECK(moved.get() == copy.get());
+        }
+        CHECK_FALSE(was_deleted);
+        CHECK(copy->value == 42);
+        copy = wind::intrusive_ptr<tracked<CountedT>>();
+        CHECK(was_deleted);
+    }
+
+    TEST_CASE("intrusive_ptr: copies keep the object alive")  // NOLINT
+    {
+        check_copies_keep_alive<wind::local_counted>();
+        check_copies_keep_alive<wind::atomic_counted>();
+        check_copies_keep_alive<wind::bias_counted>();
+    }
+
+    TEST_CASE("intrusive_ptr: use_count counts like the matching shared_ptr")  // NOLINT
+    {
+        auto local = wind::make_intrusive<tracked<wind::local_counted>>();
+        auto local_copy = local;
+        CHECK(local.use_count() == 2);
+
+        auto atomic = wind::make_intrusive<tracked<wind::atomic_counted>>();
+        auto atomic_copy = atomic;
+        CHECK(atomic.use_count() == 2);
+
+        // threads holding references, like bias::shared_ptr
+        auto bias = wind::make_intrusive<tracked<wind::bias_counted>>();
+        auto bias_copy = bias;
+        CHECK(bias.use_count() == 1);
+    }
+
+    template<template<typename> typename CountedT>
+    void check_from_raw_pointer()
+    {
+        auto was_deleted = false;
+        auto ptr = wind::make_intrusive<tracked<CountedT>>(42, &was_deleted);
+        auto from_raw = wind::intrusive_ptr<tracked<CountedT>>(ptr.get());
+        ptr = wind::intrusive_ptr<tracked<CountedT>>();
+        CHECK_FALSE(was_deleted);
+        CHECK(from_raw->value == 42);
+        from_raw = wind::intrusive_ptr<tracked<CountedT>>();
+        CHECK(was_deleted);
+    }
+
+    TEST_CASE("intrusive_ptr: a raw pointer to an owned object takes a new reference")  // NOLINT
+    {
+        check_from_raw_pointer<wind::local_counted>();
+        check_from_raw_pointer<wind::atomic_counted>();
+        check_from_raw_pointer<wind::bias_counted>();
+    }
+
+    template<template<typename> typename CountedT>
+    void check_converts_to_base()
+    {
+        auto was_deleted = false;
+        auto derived = wind::make_intrusive<derived_tracked<CountedT>>(42, &was_deleted);
+        wind::intrusive_ptr<tracked<CountedT>> base = derived;
+        derived = wind::intrusive_ptr<derived_tracked<CountedT>>();
+        CHECK_FALSE(was_deleted);
+        CHECK(base->value == 42);
+        wind::intrusive_ptr<const tracked<CountedT>> const_base = std::move(base);
+        CHECK_FALSE(base);
+        CHECK(const_base->value == 42);
+        const_base = wind::intrusive_ptr<const tracked<CountedT>>();
+        CHECK(was_deleted);
+    }
+
+    TEST_CASE("intrusive_ptr: converts to a pointer to a base")  // NOLINT
+    {
+        check_converts_to_base<wind::local_counted>();
+        check_converts_to_base<wind::atomic_counted>();
+        check_converts_to_base<wind::bias_counted>();
+    }
+
+    template<template<typename> typename CountedT>
+    void check_copied_object()
+    {
+        auto was_deleted = false;
+        auto ptr = wind::make_intrusive<tracked<CountedT>>(42, &was_deleted);
+        auto copied = wind::make_intrusive<tracked<CountedT>>(*ptr);
+        copied->was_deleted = nullptr;
+        CHECK(copied->value == 42);
+        CHECK(copied.use_count() == 1);
+        ptr = wind::intrusive_ptr<tracked<CountedT>>();
+        CHECK(was_deleted);
+        CHECK(copied->value == 42);
+    }
+
+    TEST_CASE("intrusive_ptr: a copied object gets its own count")  // NOLINT
+    {
+        check_copied_object<wind::local_counted>();
+        check_copied_object<wind::atomic_counted>();
+        check_copied_object<wind::bias_counted>();
+    }
+
+    TEST_CASE("intrusive_ptr: a bias counted object that is never shared can be destroyed directly")  // NOLINT
+    {
+        auto was_deleted = false;
+        {
+            auto object = tracked<wind::bias_counted>(42, &was_deleted);
+            CHECK(object.value == 42);
+        }
+        CHECK(was_deleted);
+
+        // the next object may reuse the key
+        auto ptr = wind::make_intrusive<tracked<wind::bias_counted>>();
+        auto copy = ptr;
+        ptr = wind::intrusive_ptr<tracked<wind::bias_counted>>();
+        CHECK(copy.use_count() == 1);
+    }
+
+    TEST_CASE("intrusive_ptr: a bias counted object released on another thread is destroyed there")  // NOLINT
+    {
+        auto was_deleted = false;
+        auto ptr = wind::make_intrusive<tracked<wind::bias_counted>>(42, &was_deleted);
+
+        // the creating thread never counted the reference, so nothing is left behind for it to hand back
+        std::thread([moved = std::move(ptr)]() mutable { moved = wind::intrusive_ptr<tracked<wind::bias_counted>>(); })
+            .join();
+        CHECK(was_deleted);
+    }
+
+    template<template<typename> typename CountedT>
+    void check_copies_on_other_threads()
+    {
+        auto was_deleted = false;
+        auto ptr = wind::make_intrusive<tracked<CountedT>>(42, &was_deleted);
+        auto copies = std::vector<wind::intrusive_ptr<tracked<CountedT>>>();
+
+        auto thread = std::thread(
+            [&ptr, &copies]()
+            {
+                auto copy = ptr;
+                copies.push_back(copy);
+                copies.push_back(copy);
+            });
+        thread.join();
+
+        ptr = wind::intrusive_ptr<tracked<CountedT>>();
+        CHECK_FALSE(was_deleted);
+        copies.pop_back();
+        CHECK_FALSE(was_deleted);
+        CHECK(copies.back()->value == 42);
+        copies.pop_back();
+        CHECK(was_deleted);
+    }
+
+    TEST_CASE("intrusive_ptr: copies left behind by another thread keep the object alive")  // NOLINT
+    {
+        check_copies_on_other_threads<wind::atomic_counted>();
+        check_copies_on_other_threads<wind::bias_counted>();
+    }
+}
@@ -1,9 +1,46 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
 #include <functional>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
 #include <vector>
 
 #include <doctest/doctest.h>
 #include <shared_ptr/local_shared_ptr.hpp>
 
+namespace
+{
+// over-aligned allocations of the calling thread not freed yet, which covers the arrays of make_shared
+thread_local int live_aligned_allocations = 0;
+}  // namespace
+
+auto operator new(std::size_t size, std::align_val_t alignment) -> void*
+{
+    auto align = static_cast<std::size_t>(alignment);
+    auto* memory = std::aligned_alloc(align, (std::max(size, std::size_t {1}) + align - 1) / align * align);
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+    live_aligned_allocations++;
+    return memory;
+}
+
+void operator delete(void* memory, std::align_val_t /*alignment*/) noexcept
+{
+    if (memory != nullptr) {
+        live_aligned_allocations--;
+        std::free(memory);  // NOLINT(cppcoreguidelines-no-malloc)
+    }
+}
+
+void operator delete(void* memory, std::size_t /*size*/, std::align_val_t alignment) noexcept
+{
+    operator delete(memory, alignment);
+}
+
 TEST_SUITE("local::shared_ptr")  // NOLINT
 {
     TEST_CASE("local::shared_ptr: make_shared works")  // NOLINT
@@ -112,4 +149,411 @@ TEST_SUITE("local::shared_ptr")  // NOLINT
             ptrs.push_back(wind::local::make_shared<int>(42 * i));
         }
     }
-}
\ No newline at end of file
+
+    struct pair_of_ints  // NOLINT
+    {
+        int first;
+        int second;
+    };
+
+    TEST_CASE("local::shared_ptr: aliasing constructor shares ownership")  // NOLINT
+    {
+        auto pair = wind::local::make_shared<pair_of_ints>(1, 2);
+        auto second = wind::local::shared_ptr<int>(pair, &pair->second);
+        CHECK(*second == 2);
+        CHECK(pair.use_count() == 2);
+
+        pair = wind::local::shared_ptr<pair_of_ints>();
+        CHECK(second.use_count() == 1);
+        CHECK(*second == 2);
+    }
+
+    TEST_CASE("local::shared_ptr: aliasing move constructor steals ownership")  // NOLINT
+    {
+        auto pair = wind::local::make_shared<pair_of_ints>(1, 2);
+        auto first = wind::local::shared_ptr<int>(std::move(pair), &pair->first);
+        CHECK(!pair);
+        CHECK(*first == 1);
+        CHECK(first.use_count() == 1);
+    }
+
+    struct base  // NOLINT
+    {
+        int value {1};
+        virtual ~base() = default;
+    };
+
+    struct derived : base  // NOLINT
+    {
+        bool* was_deleted {nullptr};
+        ~derived() override
+        {
+            *this->was_deleted = true;
+        }
+    };
+
+    TEST_CASE("local::shared_ptr: converts to a base class pointer")  // NOLINT
+    {
+        auto was_deleted = false;
+        {
+            auto derived_ptr = wind::local::make_shared<derived>();
+            derived_ptr->was_deleted = &was_deleted;
+            wind::local::shared_ptr<base> base_ptr = derived_ptr;
+            CHECK(base_ptr->value == 1);
+            CHECK(base_ptr.use_count() == 2);
+        }
+        CHECK(was_deleted);
+    }
+
+    TEST_CASE("local::shared_ptr: swap exchanges pointers")  // NOLINT
+    {
+        auto first = wind::local::make_shared<int>(1);
+        auto second = wind::local::make_shared<int>(2);
+        first.swap(second);
+        CHECK(*first == 2);
+        CHECK(*second == 1);
+    }
+
+    TEST_CASE("local::weak_ptr: lock returns the object while it is alive")  // NOLINT
+    {
+        auto ptr = wind::local::make_shared<int>(42);
+        auto weak = wind::local::weak_ptr<int>(ptr);
+        CHECK(!weak.expired());
+
+        auto locked = weak.lock();
+        CHECK(*locked == 42);
+        CHECK(ptr.use_count() == 2);
+    }
+
+    TEST_CASE("local::weak_ptr: object is destroyed while weak_ptrs remain")  // NOLINT
+    {
+        bool was_called = false;
+        auto weak = wind::local::weak_ptr<deleter_func_2>();
+        {
+            auto ptr = wind::local::make_shared<deleter_func_2>([&was_called]() { was_called = true; });
+            weak = ptr;
+            auto weak_copy = weak;
+            CHECK(!weak_copy.expired());
+        }
+        CHECK(was_called);
+        CHECK(weak.expired());
+        CHECK(!weak.lock());
+    }
+
+    TEST_CASE("local::weak_ptr: default constructed is expired")  // NOLINT
+    {
+        auto weak = wind::local::weak_ptr<int>();
+        CHECK(weak.expired());
+        CHECK(!weak.lock());
+    }
+
+    template<typename T>
+    struct counting_allocator
+    {
+        using value_type = T;
+
+        int* allocations;
+
+        explicit counting_allocator(int* i_allocations) noexcept
+            : allocations(i_allocations)
+        {
+        }
+
+        template<typename U>
+        counting_allocator(const counting_allocator<U>& other) noexcept  // NOLINT(google-explicit-constructor)
+            : allocations(other.allocations)
+        {
+        }
+
+        auto allocate(size_t n) -> T*
+        {
+            (*this->allocations)++;
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* ptr, size_t n) noexcept
+        {
+            (*this->allocations)--;
+            std::allocator<T>().deallocate(ptr, n);
+        }
+
+        template<typename U>
+        auto operator==(const counting_allocator<U>& other) const noexcept -> bool
+        {
+            return this->allocations == other.allocations;
+        }
+    };
+
+    TEST_CASE("local::shared_ptr: allocate_shared allocates and frees through the allocator")  // NOLINT
+    {
+        int allocations = 0;
+        {
+            auto ptr = wind::local::allocate_shared<int>(counting_allocator<int>(&allocations), 42);
+            auto copy = ptr;
+            CHECK(*copy == 42);
+            CHECK(allocations == 1);
+        }
+        CHECK(allocations == 0);
+    }
+
+    TEST_CASE("local::shared_ptr: allocate_shared frees the block if the value throws")  // NOLINT
+    {
+        struct throwing
+        {
+            explicit throwing(int /*value*/)
+            {
+                throw std::runtime_error("throwing");
+            }
+        };
+
+        int allocations = 0;
+        CHECK_THROWS_AS(wind::local::allocate_shared<throwing>(counting_allocator<int>(&allocations), 42),
+                        std::runtime_error);
+        CHECK(allocations == 0);
+    }
+
+    TEST_CASE("local::shared_ptr: allocate_shared keeps the block allocated for weak_ptrs")  // NOLINT
+    {
+        int allocations = 0;
+        bool was_called = false;
+        auto weak = wind::local::weak_ptr<deleter_func_2>();
+        {
+            auto ptr = wind::local::allocate_shared<deleter_func_2>(counting_allocator<int>(&allocations),
+                                                                     [&was_called]() { was_called = true; });
+            weak = ptr;
+        }
+        CHECK(was_called);
+        CHECK(allocations == 1);
+        weak.reset();
+        CHECK(allocations == 0);
+    }
+
+    TEST_CASE("local::shared_ptr: allocate_shared works with polymorphic allocators")  // NOLINT
+    {
+        auto buffer = std::array<std::byte, 1024>();
+        auto resource = std::pmr::monotonic_buffer_resource(buffer.data(), buffer.size());
+        auto ptr = wind::local::allocate_shared<int>(std::pmr::polymorphic_allocator<int>(&resource), 42);
+        auto* address = reinterpret_cast<std::byte*>(ptr.get());  // NOLINT
+        CHECK(*ptr == 42);
+        CHECK(address >= buffer.data());
+        CHECK(address < buffer.data() + buffer.size());  // NOLINT
+    }
+
+    auto read_through(wind::local::borrowed_ptr<int> borrowed, int depth) -> int
+    {
+        if (depth == 0) {
+            return *borrowed;
+        }
+        return read_through(borrowed, depth - 1);
+    }
+
+    TEST_CASE("local::borrowed_ptr: borrowing does not count references")  // NOLINT
+    {
+        auto ptr = wind::local::make_shared<int>(42);
+        CHECK(read_through(ptr, 8) == 42);
+        auto borrowed = wind::local::borrowed_ptr<int>(ptr);
+        CHECK(borrowed.get() == ptr.get());
+        CHECK(ptr.use_count() == 1);
+        CHECK(!wind::local::borrowed_ptr<int>());
+    }
+
+    TEST_CASE("local::borrowed_ptr: to_shared takes an owning copy")  // NOLINT
+    {
+        auto owner = wind::local::make_shared<int>(42);
+        auto borrowed = wind::local::borrowed_ptr<int>(owner);
+        auto copy = borrowed.to_shared();
+        CHECK(copy.get() == owner.get());
+        owner = wind::local::shared_ptr<int>();
+        CHECK(*copy == 42);
+        CHECK(!wind::local::borrowed_ptr<int>().to_shared());
+    }
+
+    TEST_CASE("local::shared_ptr: make_shared of an unbounded array value-initializes its elements")  // NOLINT
+    {
+        auto ptr = wind::local::make_shared<int[]>(16);  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        for (auto i = 0; i < 16; i++) {
+            CHECK(ptr[i] == 0);
+            ptr[i] = i;
+        }
+        auto copy = ptr;
+        CHECK(copy[15] == 15);
+
+        auto filled = wind::local::make_shared<int[]>(4, 7);  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        CHECK(filled[0] == 7);
+        CHECK(filled[3] == 7);
+    }
+
+    TEST_CASE("local::shared_ptr: make_shared of a bounded array destroys every element")  // NOLINT
+    {
+        struct counted
+        {
+            int* destroyed;
+            explicit counted(int* i_destroyed)
+                : destroyed(i_destroyed)
+            {
+            }
+            counted(const counted&) = default;
+            counted(counted&&) = delete;
+            auto operator=(const counted&) -> counted& = delete;
+            auto operator=(counted&&) -> counted& = delete;
+            ~counted()
+            {
+                (*this->destroyed)++;
+            }
+        };
+
+        auto destroyed = 0;
+        {
+            auto ptr = wind::local::make_shared<counted[3]>(counted(&destroyed));  // NOLINT
+            destroyed = 0;
+            CHECK(ptr[2].destroyed == &destroyed);
+        }
+        CHECK(destroyed == 3);
+    }
+
+    struct throwing_third
+    {
+        static inline int constructed {0};
+        static inline int alive {0};
+
+        throwing_third()
+        {
+            if (++constructed == 3) {
+                throw std::runtime_error("third");
+            }
+            alive++;
+        }
+        throwing_third(const throwing_third&) = delete;
+        throwing_third(throwing_third&&) = delete;
+        auto operator=(const throwing_third&) -> throwing_third& = delete;
+        auto operator=(throwing_third&&) -> throwing_third& = delete;
+        ~throwing_third()
+        {
+            alive--;
+        }
+    };
+
+    TEST_CASE("local::shared_ptr: make_shared of an array frees everything if an element throws")  // NOLINT
+    {
+        auto allocations_before = live_aligned_allocations;
+        CHECK_THROWS_AS(wind::local::make_shared<throwing_third[]>(4),  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+                        std::runtime_error);
+        CHECK(throwing_third::constructed == 3);
+        CHECK(throwing_third::alive == 0);
+        CHECK(live_aligned_allocations == allocations_before);
+    }
+
+    TEST_CASE("local::shared_ptr: array elements respect their alignment")  // NOLINT
+    {
+        struct alignas(64) aligned
+        {
+            char value;
+        };
+
+        auto ptr = wind::local::make_shared<aligned[]>(3);  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        for (auto i = 0; i < 3; i++) {
+            CHECK(reinterpret_cast<std::uintptr_t>(&ptr[i]) % 64 == 0);  // NOLINT
+        }
+    }
+
+    TEST_CASE("local::shared_ptr: arrays taken over from new[] are deleted with delete[]")  // NOLINT
+    {
+        auto ptr = wind::local::shared_ptr<int[]>(new int[4] {1, 2, 3, 4});  // NOLINT
+        CHECK(ptr[3] == 4);
+    }
+
+    struct self_aware : wind::local::enable_shared_from_this<self_aware>
+    {
+        // not an aggregate, so make_shared does not initialize the protected base directly
+        self_aware() = default;
+
+        int value = 42;
+    };
+
+    TEST_CASE("local::enable_shared_from_this: make_shared links the object to its owner")  // NOLINT
+    {
+        auto ptr = wind::local::make_shared<self_aware>();
+        auto self = ptr->shared_from_this();
+        CHECK(self.get() == ptr.get());
+        ptr = wind::local::shared_ptr<self_aware>();
+        CHECK(self->value == 42);
+        CHECK(!self->weak_from_this().expired());
+    }
+
+    TEST_CASE("local::enable_shared_from_this: taking over a raw pointer links it")  // NOLINT
+    {
+        auto ptr = wind::local::shared_ptr<self_aware>(new self_aware());  // NOLINT(cppcoreguidelines-owning-memory)
+        const auto& constant = *ptr;
+        auto self = constant.shared_from_this();
+        CHECK(self.get() == ptr.get());
+    }
+
+    TEST_CASE("local::enable_shared_from_this: unowned objects throw bad_weak_ptr")  // NOLINT
+    {
+        auto object = self_aware();
+        CHECK_THROWS_AS(static_cast<void>(object.shared_from_this()), std::bad_weak_ptr);
+        CHECK(object.weak_from_this().expired());
+
+        auto owned = wind::local::make_shared<self_aware>(object);
+        CHECK(owned->shared_from_this().get() == owned.get());
+        CHECK_THROWS_AS(static_cast<void>(object.shared_from_this()), std::bad_weak_ptr);
+    }
+
+    TEST_CASE("local::shared_ptr: make_shared of a trivially destructible value needs no manager")  // NOLINT
+    {
+        auto weak = wind::local::weak_ptr<int64_t>();
+        {
+            // the block make_shared allocates, also when it draws it from the slab pools
+            auto* control = wind::detail::new_control_block_with_data<wind::local::detail::control_block, int64_t>(42);
+            CHECK(control->manage == nullptr);
+            auto ptr = wind::local::shared_ptr<int64_t>(control);
+            // found behind the control block without knowing its type
+            CHECK(static_cast<wind::local::detail::control_block*>(control)->get_data() == ptr.get());
+            weak = ptr;
+        }
+        // the control block outlives the value for the weak_ptr
+        CHECK(weak.expired());
+
+        auto* function_control =
+            wind::detail::new_control_block_with_data<wind::local::detail::control_block, std::function<int()>>(
+                []() { return 42; });
+        CHECK(function_control->manage != nullptr);
+        auto function = wind::local::shared_ptr<std::function<int()>>(function_control);
+        CHECK((*function)() == 42);
+    }
+
+    TEST_CASE("local::shared_ptr: make_shared_n gives objects with their own counts")  // NOLINT
+    {
+        auto ptrs = wind::local::make_shared_n<int64_t>(4, 7);
+        CHECK(ptrs.size() == 4);
+        *ptrs[0] = 1;
+        CHECK(*ptrs[0] == 1);
+        CHECK(*ptrs[3] == 7);
+        CHECK(ptrs[3].use_count() == 1);
+
+        auto weak = wind::local::weak_ptr<int64_t>(ptrs[2]);
+        auto kept = ptrs[1];
+        ptrs.clear();
+        CHECK(weak.expired());
+        CHECK(*kept == 7);
+    }
+
+    TEST_CASE("local::shared_ptr: copy_all and release_all copy and empty a range")  // NOLINT
+    {
+        auto first = wind::local::make_shared<int>(1);
+        auto second = wind::local::make_shared<int>(2);
+        auto ptrs = std::vector {first, second, first, wind::local::shared_ptr<int>(), first};
+        CHECK(first.use_count() == 4);
+
+        auto copies = wind::copy_all(ptrs);
+        CHECK(first.use_count() == 7);
+        CHECK(second.use_count() == 3);
+        CHECK(*copies[1] == 2);
+        CHECK_FALSE(copies[3]);
+
+        wind::release_all(copies);
+        CHECK_FALSE(copies[0]);
+        CHECK(first.use_count() == 4);
+        CHECK(second.use_count() == 2);
+    }
+}
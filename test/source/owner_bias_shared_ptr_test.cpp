@@ -0,0 +1,284 @@
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <shared_ptr/owner_bias_shared_ptr.hpp>
+
+TEST_SUITE("owner_bias::shared_ptr")  // NOLINT
+{
+    // NOLINTNEXTLINE
+    struct deleter_ref
+    {
+        bool* was_deleted {nullptr};
+        ~deleter_ref()
+        {
+            *this->was_deleted = true;
+        }
+    };
+
+    TEST_CASE("owner_bias::shared_ptr: make_shared works")  // NOLINT
+    {
+        auto ptr = wind::owner_bias::make_shared<int>(42);
+        CHECK(*ptr == 42);
+        CHECK(ptr.use_count() == 1);
+        CHECK(ptr.unique());
+    }
+
+    TEST_CASE("owner_bias::shared_ptr: copies on the owner are counted")  // NOLINT
+    {
+        auto was_deleted = false;
+        {
+            auto ptr = wind::owner_bias::make_shared<deleter_ref>();
+            ptr->was_deleted = &was_deleted;
+            {
+                auto copy = ptr;
+                CHECK(ptr.use_count() == 2);
+            }
+            CHECK(ptr.use_count() == 1);
+            CHECK(!was_deleted);
+        }
+        CHECK(was_deleted);
+    }
+
+    TEST_CASE("owner_bias::shared_ptr: deleter is called")  // NOLINT
+    {
+        auto was_called = false;
+        {
+            auto ptr = wind::owner_bias::shared_ptr<int>(new int(42),  // NOLINT
+                                                         [&was_called](int* data)
+                                                         {
+                                                             was_called = true;
+                                                             delete data;  // NOLINT
+                                                         });
+            CHECK(*ptr == 42);
+        }
+        CHECK(was_called);
+    }
+
+    TEST_CASE("owner_bias::shared_ptr: aliasing shares ownership")  // NOLINT
+    {
+        struct pair_of_ints  // NOLINT
+        {
+            int first;
+            int second;
+        };
+
+        auto pair = wind::owner_bias::make_shared<pair_of_ints>(1, 2);
+        auto second = wind::owner_bias::shared_ptr<int>(pair, &pair->second);
+        CHECK(*second == 2);
+        CHECK(pair.use_count() == 2);
+    }
+
+    TEST_CASE("owner_bias::shared_ptr: copies released on other threads are merged by the owner")  // NOLINT
+    {
+        auto was_deleted = false;
+        auto ptr = wind::owner_bias::make_shared<deleter_ref>();
+        ptr->was_deleted = &was_deleted;
+
+        auto copies = std::vector<wind::owner_bias::shared_ptr<deleter_ref>>(4, ptr);
+        auto thread = std::thread([&copies]() { copies.clear(); });
+        thread.join();
+        CHECK(!was_deleted);
+
+        // the copies were made by the owner, so it still counts them until it merges its queue
+        ptr = wind::owner_bias::shared_ptr<deleter_ref>();
+        CHECK(!was_deleted);
+        wind::owner_bias::merge_queued();
+        CHECK(was_deleted);
+    }
+
+    TEST_CASE("owner_bias::shared_ptr: the last copy can be released by another thread")  // NOLINT
+    {
+        auto was_deleted = false;
+        auto copy = wind::owner_bias::shared_ptr<deleter_ref>();
+        {
+            auto ptr = wind::owner_bias::make_shared<deleter_ref>();
+            ptr->was_deleted = &was_deleted;
+            copy = ptr;
+        }
+        CHECK(!was_deleted);
+
+        auto thread = std::thread([&copy]() { copy = wind::owner_bias::shared_ptr<deleter_ref>(); });
+        thread.join();
+
+        wind::owner_bias::merge_queued();
+        CHECK(was_deleted);
+    }
+
+    TEST_CASE("owner_bias::shared_ptr: objects outlive their owner thread")  // NOLINT
+    {
+        auto was_deleted = false;
+        auto ptr = wind::owner_bias::shared_ptr<deleter_ref>();
+        auto thread = std::thread(
+            [&ptr, &was_deleted]()
+            {
+                auto created = wind::owner_bias::make_shared<deleter_ref>();
+                created->was_deleted = &was_deleted;
+                ptr = created;
+            });
+        thread.join();
+
+        auto copy = ptr;
+        CHECK(*copy->was_deleted == false);
+        ptr = wind::owner_bias::shared_ptr<deleter_ref>();
+        CHECK(!was_deleted);
+        copy = wind::owner_bias::shared_ptr<deleter_ref>();
+        CHECK(was_deleted);
+    }
+
+    TEST_CASE("owner_bias::shared_ptr: concurrent copies from many threads")  // NOLINT
+    {
+        auto was_deleted = false;
+        {
+            auto ptr = wind::owner_bias::make_shared<deleter_ref>();
+            ptr->was_deleted = &was_deleted;
+
+            auto threads = std::vector<std::thread>();
+            for (auto t = 0; t < 4; t++) {
+                threads.emplace_back(
+                    [ptr]()
+                    {
+                        for (auto i = 0; i < 1000; i++) {
+                            auto copy = ptr;
+                            CHECK(copy);
+                        }
+                    });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            CHECK(!was_deleted);
+        }
+        wind::owner_bias::merge_queued();
+        CHECK(was_deleted);
+    }
+
+    auto read_through(wind::owner_bias::borrowed_ptr<int> borrowed, int depth) -> int
+    {
+        if (depth == 0) {
+            return *borrowed;
+        }
+        return read_through(borrowed, depth - 1);
+    }
+
+    TEST_CASE("owner_bias::borrowed_ptr: borrowing does not count references")  // NOLINT
+    {
+        auto ptr = wind::owner_bias::make_shared<int>(42);
+        CHECK(read_through(ptr, 8) == 42);
+        auto borrowed = wind::owner_bias::borrowed_ptr<int>(ptr);
+        CHECK(borrowed.get() == ptr.get());
+        CHECK(ptr.use_count() == 1);
+        CHECK(!wind::owner_bias::borrowed_ptr<int>());
+    }
+
+    TEST_CASE("owner_bias::borrowed_ptr: to_shared takes an owning copy")  // NOLINT
+    {
+        auto owner = wind::owner_bias::make_shared<int>(42);
+        auto borrowed = wind::owner_bias::borrowed_ptr<int>(owner);
+        auto copy = borrowed.to_shared();
+        CHECK(copy.get() == owner.get());
+        owner = wind::owner_bias::shared_ptr<int>();
+        CHECK(*copy == 42);
+        CHECK(!wind::owner_bias::borrowed_ptr<int>().to_shared());
+    }
+
+    TEST_CASE("owner_bias::shared_ptr: make_shared of an unbounded array value-initializes its elements")  // NOLINT
+    {
+        auto ptr = wind::owner_bias::make_shared<int[]>(16);  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        for (auto i = 0; i < 16; i++) {
+            CHECK(ptr[i] == 0);
+            ptr[i] = i;
+        }
+        auto copy = ptr;
+        CHECK(copy[15] == 15);
+
+        auto filled = wind::owner_bias::make_shared<int[]>(4, 7);  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        CHECK(filled[0] == 7);
+        CHECK(filled[3] == 7);
+    }
+
+    TEST_CASE("owner_bias::shared_ptr: make_shared of a bounded array destroys every element")  // NOLINT
+    {
+        struct counted
+        {
+            int* destroyed;
+            explicit counted(int* i_destroyed)
+                : destroyed(i_destroyed)
+            {
+            }
+            counted(const counted&) = default;
+            counted(counted&&) = delete;
+            auto operator=(const counted&) -> counted& = delete;
+            auto operator=(counted&&) -> counted& = delete;
+            ~counted()
+            {
+                (*this->destroyed)++;
+            }
+        };
+
+        auto destroyed = 0;
+        {
+            auto ptr = wind::owner_bias::make_shared<counted[3]>(counted(&destroyed));  // NOLINT
+            destroyed = 0;
+            CHECK(ptr[2].destroyed == &destroyed);
+        }
+        CHECK(destroyed == 3);
+    }
+
+    TEST_CASE("owner_bias::shared_ptr: array elements respect their alignment")  // NOLINT
+    {
+        struct alignas(64) aligned
+        {
+            char value;
+        };
+
+        auto ptr = wind::owner_bias::make_shared<aligned[]>(3);  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        for (auto i = 0; i < 3; i++) {
+            CHECK(reinterpret_cast<std::uintptr_t>(&ptr[i]) % 64 == 0);  // NOLINT
+        }
+    }
+
+    TEST_CASE("owner_bias::shared_ptr: arrays taken over from new[] are deleted with delete[]")  // NOLINT
+    {
+        auto ptr = wind::owner_bias::shared_ptr<int[]>(new int[4] {1, 2, 3, 4});  // NOLINT
+        CHECK(ptr[3] == 4);
+    }
+
+    TEST_CASE("owner_bias::weak_ptr: lock returns the object while it is alive")  // NOLINT
+    {
+        auto was_deleted = false;
+        auto ptr = wind::owner_bias::make_shared<deleter_ref>();
+        ptr->was_deleted = &was_deleted;
+        auto weak = wind::owner_bias::weak_ptr<deleter_ref>(ptr);
+
+        CHECK(weak.lock().get() == ptr.get());
+        CHECK(ptr.use_count() == 1);
+
+        ptr = wind::owner_bias::shared_ptr<deleter_ref>();
+        CHECK(was_deleted);
+        CHECK(weak.expired());
+        CHECK(!weak.lock());
+    }
+
+    TEST_CASE("owner_bias::weak_ptr: lock on another thread counts in the shared counter")  // NOLINT
+    {
+        auto was_deleted = false;
+        auto ptr = wind::owner_bias::make_shared<deleter_ref>();
+        ptr->was_deleted = &was_deleted;
+        auto weak = wind::owner_bias::weak_ptr<deleter_ref>(ptr);
+
+        auto locked = wind::owner_bias::shared_ptr<deleter_ref>();
+        std::thread([&weak, &locked]() { locked = weak.lock(); }).join();
+        CHECK(locked.get() == ptr.get());
+
+        ptr = wind::owner_bias::shared_ptr<deleter_ref>();
+        CHECK(!was_deleted);
+        CHECK(!weak.expired());
+
+        std::thread([&weak]() { CHECK(!weak.expired()); }).join();
+        locked = wind::owner_bias::shared_ptr<deleter_ref>();
+        CHECK(was_deleted);
+        std::thread([&weak]() { CHECK(!weak.lock()); }).join();
+    }
+}
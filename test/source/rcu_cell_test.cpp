@@ -0,0 +1,140 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <shared_ptr/rcu_cell.hpp>
+
+TEST_SUITE("bias::rcu_cell")  // NOLINT
+{
+    // NOLINTNEXTLINE
+    struct counted
+    {
+        static inline std::atomic<int> alive {0};
+        int value;
+
+        explicit counted(int i_value)
+            : value(i_value)
+        {
+            alive++;
+        }
+        counted(const counted&) = delete;
+        counted(counted&&) = delete;
+        auto operator=(const counted&) -> counted& = delete;
+        auto operator=(counted&&) -> counted& = delete;
+        ~counted()
+        {
+            alive--;
+        }
+    };
+
+    TEST_CASE("bias::rcu_cell: default constructed reads nullptr")  // NOLINT
+    {
+        auto cell = wind::bias::rcu_cell<int>();
+        CHECK_FALSE(cell.read());
+        CHECK_FALSE(cell.load());
+    }
+
+    TEST_CASE("bias::rcu_cell: a read keeps the previous value until the thread reads again")  // NOLINT
+    {
+        {
+            auto cell = wind::bias::rcu_cell<counted>(wind::bias::make_shared<counted>(1));
+            CHECK(cell.read()->value == 1);
+
+            cell.store(wind::bias::make_shared<counted>(2));
+            CHECK(counted::alive == 2);
+            CHECK(cell.read()->value == 2);
+            CHECK(counted::alive == 1);
+        }
+        CHECK(counted::alive == 0);
+    }
+
+    TEST_CASE("bias::rcu_cell: load returns a copy that outlives the next read")  // NOLINT
+    {
+        {
+            auto cell = wind::bias::rcu_cell<counted>(wind::bias::make_shared<counted>(1));
+            auto loaded = cell.load();
+            cell.store(wind::bias::make_shared<counted>(2));
+            CHECK(cell.read()->value == 2);
+            CHECK(loaded->value == 1);
+            CHECK(counted::alive == 2);
+        }
+        CHECK(counted::alive == 0);
+    }
+
+    TEST_CASE("bias::rcu_cell: an exiting thread releases its copy")  // NOLINT
+    {
+        auto cell = wind::bias::rcu_cell<counted>(wind::bias::make_shared<counted>(1));
+        auto seen = std::atomic<int> {0};
+        auto thread = std::thread([&cell, &seen]() { seen = cell.read()->value; });
+        thread.join();
+        CHECK(seen == 1);
+
+        cell.store(wind::bias::make_shared<counted>(2));
+        CHECK(counted::alive == 1);
+    }
+
+    TEST_CASE("bias::rcu_cell: a copy left behind for a destroyed cell is not read from the next one")  // NOLINT
+    {
+        auto read_first = std::atomic<bool> {false};
+        auto replaced = std::atomic<bool> {false};
+        auto seen = std::atomic<int> {0};
+        auto* cell = new wind::bias::rcu_cell<counted>(wind::bias::make_shared<counted>(1));  // NOLINT
+
+        auto thread = std::thread(
+            [&]()
+            {
+                static_cast<void>(cell->read());
+                read_first = true;
+                while (!replaced) {
+                    std::this_thread::yield();
+                }
+                seen = cell->read()->value;
+            });
+
+        while (!read_first) {
+            std::this_thread::yield();
+        }
+        // the next cell likely gets the same key
+        delete cell;  // NOLINT(cppcoreguidelines-owning-memory)
+        cell = new wind::bias::rcu_cell<counted>(wind::bias::make_shared<counted>(2));  // NOLINT
+        replaced = true;
+        thread.join();
+
+        CHECK(seen == 2);
+        delete cell;  // NOLINT(cppcoreguidelines-owning-memory)
+        CHECK(counted::alive == 0);
+    }
+
+    TEST_CASE("bias::rcu_cell: readers see stores in order")  // NOLINT
+    {
+        constexpr auto num_stores = 1000;
+        auto out_of_order = std::atomic<int> {0};
+        {
+            auto cell = wind::bias::rcu_cell<counted>(wind::bias::make_shared<counted>(0));
+            auto readers = std::vector<std::thread>();
+            for (auto t = 0; t < 4; t++) {
+                readers.emplace_back(
+                    [&cell, &out_of_order]()
+                    {
+                        auto last = 0;
+                        while (last != num_stores) {
+                            auto current = cell.read()->value;
+                            if (current < last) {
+                                out_of_order++;
+                            }
+                            last = current;
+                        }
+                    });
+            }
+            for (auto i = 1; i <= num_stores; i++) {
+                cell.store(wind::bias::make_shared<counted>(i));
+            }
+            for (auto& reader : readers) {
+                reader.join();
+            }
+        }
+        CHECK(out_of_order == 0);
+        CHECK(counted::alive == 0);
+    }
+}
@@ -0,0 +1,76 @@
+#include <array>
+#include <thread>
+
+#include <doctest/doctest.h>
+#include <shared_ptr/bias_shared_ptr.hpp>
+#include <shared_ptr/local_shared_ptr.hpp>
+#include <shared_ptr/slab_allocator.hpp>
+
+TEST_SUITE("slab_allocator")  // NOLINT
+{
+    // each test uses its own size class, so blocks left behind by other tests do not interfere
+    template<size_t Size>
+    struct sized
+    {
+        std::array<std::byte, Size> bytes;
+    };
+
+    TEST_CASE("slab_allocator: freed blocks are reused")  // NOLINT
+    {
+        auto alloc = wind::slab_allocator<sized<200>>();
+        auto* first = alloc.allocate(1);
+        alloc.deallocate(first, 1);
+        auto* second = alloc.allocate(1);
+        CHECK(first == second);
+        alloc.deallocate(second, 1);
+    }
+
+    TEST_CASE("slab_allocator: consecutive blocks are distinct")  // NOLINT
+    {
+        auto alloc = wind::slab_allocator<sized<184>>();
+        auto* first = alloc.allocate(1);
+        auto* second = alloc.allocate(1);
+        CHECK(first != second);
+        alloc.deallocate(first, 1);
+        alloc.deallocate(second, 1);
+    }
+
+    TEST_CASE("slab_allocator: blocks freed on another thread return to their owner")  // NOLINT
+    {
+        auto alloc = wind::slab_allocator<sized<216>>();
+        auto* block = alloc.allocate(1);
+        auto thread = std::thread([&alloc, block]() { alloc.deallocate(block, 1); });
+        thread.join();
+
+        auto* reused = alloc.allocate(1);
+        CHECK(reused == block);
+        alloc.deallocate(reused, 1);
+    }
+
+    TEST_CASE("slab_allocator: large objects and arrays fall back to std::allocator")  // NOLINT
+    {
+        CHECK(wind::slab_allocator<sized<256>>::uses_slab(1));
+        CHECK(!wind::slab_allocator<sized<512>>::uses_slab(1));
+        CHECK(!wind::slab_allocator<int>::uses_slab(4));
+
+        auto alloc = wind::slab_allocator<sized<512>>();
+        auto* block = alloc.allocate(1);
+        alloc.deallocate(block, 1);
+    }
+
+    TEST_CASE("slab_allocator: allocate_shared works across threads")  // NOLINT
+    {
+        auto local = wind::local::allocate_shared<int>(wind::slab_allocator<int>(), 42);
+        CHECK(*local == 42);
+
+        auto bias = wind::bias::allocate_shared<int>(wind::slab_allocator<int>(), 42);
+        auto thread = std::thread(
+            [bias]() mutable
+            {
+                CHECK(*bias == 42);
+                bias = wind::bias::allocate_shared<int>(wind::slab_allocator<int>(), 1);
+            });
+        thread.join();
+        CHECK(*bias == 42);
+    }
+}
@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <shared_ptr/thread_local_storage.hpp>
+
+TEST_SUITE("thread_local_storage")  // NOLINT
+{
+    using storage = wind::thread_local_storage<size_t>;
+
+    TEST_CASE("thread_local_storage: created keys can be looked up")  // NOLINT
+    {
+        auto key = storage::create_key(42);
+        CHECK(storage::contains(key));
+        CHECK(storage::get(key) == 42);
+
+        auto [value, already_existed] = storage::get_or_create(key, 0);
+        CHECK(already_existed);
+        CHECK(value.get() == 42);
+
+        storage::return_key(key);
+        CHECK(!storage::contains(key));
+        storage::destroy_key(key);
+    }
+
+    TEST_CASE("thread_local_storage: destroyed keys are reused")  // NOLINT
+    {
+        auto first = storage::create_key(1);
+        storage::return_key(first);
+        storage::destroy_key(first);
+
+        auto second = storage::create_key(2);
+        CHECK(second == first);
+        CHECK(storage::get(second) == 2);
+        storage::return_key(second);
+        storage::destroy_key(second);
+    }
+
+    TEST_CASE("thread_local_storage: get_or_create creates missing values")  // NOLINT
+    {
+        auto key = storage::create_key(1);
+        storage::return_key(key);
+
+        auto [value, already_existed] = storage::get_or_create(key, 7);
+        CHECK(!already_existed);
+        CHECK(value.get() == 7);
+        storage::return_key(key);
+        storage::destroy_key(key);
+    }
+
+    TEST_CASE("thread_local_storage: a key names a separate value on every thread")  // NOLINT
+    {
+        auto key = storage::create_key(1);
+
+        auto thread = std::thread(
+            [key]()
+            {
+                CHECK(!storage::contains(key));
+                auto [value, already_existed] = storage::get_or_create(key, 2);
+                CHECK(!already_existed);
+                CHECK(value.get() == 2);
+                storage::return_key(key);
+            });
+        thread.join();
+
+        CHECK(storage::get(key) == 1);
+        storage::return_key(key);
+        storage::destroy_key(key);
+    }
+
+    TEST_CASE("thread_local_storage: keys are unique across threads")  // NOLINT
+    {
+        auto key = storage::create_key(1);
+        auto other_key = key;
+
+        auto thread = std::thread([&other_key]() { other_key = storage::create_key(1); });
+        thread.join();
+
+        CHECK(key != other_key);
+        storage::return_key(key);
+        storage::destroy_key(key);
+        storage::destroy_key(other_key);
+    }
+
+    TEST_CASE("thread_local_storage: memory_usage grows with the keys a thread holds")  // NOLINT
+    {
+        auto before = storage::memory_usage();
+        CHECK(before >= storage::initial_storage * sizeof(size_t));
+
+        auto keys = std::vector<storage::key_t>();
+        for (size_t i = 0; i < 2 * storage::initial_storage; i++) {
+            keys.push_back(storage::create_key(i));
+        }
+        CHECK(storage::memory_usage() > before);
+
+        for (auto key : keys) {
+            storage::return_key(key);
+            storage::destroy_key(key);
+        }
+    }
+
+    TEST_CASE("thread_local_storage: memory_usage includes the slots below the highest key")  // NOLINT
+    {
+        auto keys = std::vector<storage::key_t>();
+        for (size_t i = 0; i < 4 * storage::initial_storage; i++) {
+            keys.push_back(storage::create_key());
+        }
+        auto highest = *std::max_element(keys.begin(), keys.end());
+
+        // a thread holding a single value still pays for every slot below its key
+        auto usage = size_t {0};
+        std::thread(
+            [highest, &usage]()
+            {
+                storage::get_or_create(highest, 1);
+                usage = storage::memory_usage();
+                storage::return_key(highest);
+            })
+            .join();
+        CHECK(usage >= (highest + 1) * sizeof(size_t));
+
+        for (auto key : keys) {
+            storage::destroy_key(key);
+        }
+    }
+}